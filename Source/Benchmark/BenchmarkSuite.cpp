@@ -0,0 +1,408 @@
+#include "Precompiled.h"
+#include <algorithm>
+#include <random>
+#include <string>
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(_MSC_VER)
+#include <x86intrin.h>
+#endif
+
+// Usage : BenchmarkSuite [--iterations=N] [--resolutions=WxH,WxH,...] [--filter=Text] [--json=Path] [--csv=Path]
+// Runs the Math and Renderer kernels tracked between releases and prints one line per case.
+// Every case is timed --iterations times and the median is kept, both in nanoseconds and in
+// time stamp counter cycles per item, which tick at the nominal clock rate on x86 and fall back to
+// nanoseconds elsewhere. Bandwidth counts the bytes the kernel has to read and write.
+namespace
+{
+	struct Result
+	{
+		std::string Group;
+		std::string Name;
+		std::string Resolution;
+		std::string Unit;
+		UINT64 Items = 0;
+		double NanoSecondsPerItem = 0.0;
+		double CyclesPerItem = 0.0;
+		double GigaBytesPerSecond = 0.0;
+		double MilliSeconds = 0.0;
+	};
+
+	struct Options
+	{
+		int Iterations = 31;
+		std::vector<ScreenPoint> Resolutions = { ScreenPoint(640, 480), ScreenPoint(1280, 720), ScreenPoint(1920, 1080) };
+		std::string Filter;
+		std::string JsonPath;
+		std::string CsvPath;
+	};
+
+	// Other architectures have no portable cycle counter, so the cycle columns count nanoseconds there.
+	UINT64 ReadCycleCounter()
+	{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+		return __rdtsc();
+#else
+		return (UINT64)std::chrono::duration_cast<std::chrono::nanoseconds>(BenchmarkUtil::Clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	const char* GetCycleCounterName()
+	{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+		return "cycles are time stamp counter ticks";
+#else
+		return "cycles are nanoseconds";
+#endif
+	}
+
+	const char* GetSimdName()
+	{
+#if defined(MATH_SIMD_AVX2)
+		return "AVX2";
+#elif defined(MATH_SIMD_SSE2)
+		return "SSE2";
+#else
+		return "Scalar";
+#endif
+	}
+
+	const char* GetCompilerName()
+	{
+#if defined(__clang__)
+		return "clang " __clang_version__;
+#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+		return "msvc";
+#else
+		return "unknown";
+#endif
+	}
+
+	class Suite
+	{
+	public:
+		explicit Suite(const Options& InOptions) : _Options(InOptions) { }
+
+		// InFunction runs the kernel once over InItems items and touches InBytes bytes.
+		template<class Function>
+		void Run(const char* InGroup, const char* InName, const std::string& InResolution, const char* InUnit, UINT64 InItems, double InBytes, Function InFunction)
+		{
+			std::string fullName = std::string(InGroup) + "/" + InName + (InResolution.empty() ? "" : "/" + InResolution);
+			if (!_Options.Filter.empty() && fullName.find(_Options.Filter) == std::string::npos)
+			{
+				return;
+			}
+
+			// The first run warms caches and lazily committed pages.
+			InFunction();
+
+			std::vector<double> times(_Options.Iterations);
+			std::vector<UINT64> cycles(_Options.Iterations);
+			for (int i = 0; i < _Options.Iterations; ++i)
+			{
+				BenchmarkUtil::Clock::time_point start = BenchmarkUtil::Clock::now();
+				UINT64 startCycles = ReadCycleCounter();
+				InFunction();
+				cycles[i] = ReadCycleCounter() - startCycles;
+				times[i] = BenchmarkUtil::GetElapsedMilliSeconds(start);
+			}
+
+			std::sort(times.begin(), times.end());
+			std::sort(cycles.begin(), cycles.end());
+			double milliSeconds = times[times.size() / 2];
+
+			Result result;
+			result.Group = InGroup;
+			result.Name = InName;
+			result.Resolution = InResolution;
+			result.Unit = InUnit;
+			result.Items = InItems;
+			result.MilliSeconds = milliSeconds;
+			result.NanoSecondsPerItem = milliSeconds * 1e6 / InItems;
+			result.CyclesPerItem = (double)cycles[cycles.size() / 2] / InItems;
+			result.GigaBytesPerSecond = milliSeconds > 0.0 ? InBytes / (milliSeconds * 1e6) : 0.0;
+			std::printf("%-36s %10llu %12.4f %12.3f %10.2f %8s\n", fullName.c_str(), (unsigned long long)InItems,
+				result.NanoSecondsPerItem, result.CyclesPerItem, result.GigaBytesPerSecond, InUnit);
+			_Results.emplace_back(std::move(result));
+		}
+
+		bool WriteJson(const std::string& InPath) const;
+		bool WriteCsv(const std::string& InPath) const;
+
+	private:
+		const Options& _Options;
+		std::vector<Result> _Results;
+	};
+
+	bool Suite::WriteJson(const std::string& InPath) const
+	{
+		FILE* file = std::fopen(InPath.c_str(), "wb");
+		if (file == nullptr)
+		{
+			return false;
+		}
+
+		std::fprintf(file, "{\n  \"suite\": \"SoftRenderer\",\n  \"compiler\": \"%s\",\n  \"simd\": \"%s\",\n  \"iterations\": %d,\n  \"results\": [\n",
+			GetCompilerName(), GetSimdName(), _Options.Iterations);
+		for (size_t i = 0; i < _Results.size(); ++i)
+		{
+			const Result& result = _Results[i];
+			std::fprintf(file, "    { \"group\": \"%s\", \"name\": \"%s\", \"resolution\": \"%s\", \"unit\": \"%s\", \"items\": %llu, "
+				"\"ms\": %.6f, \"ns_per_item\": %.6f, \"cycles_per_item\": %.6f, \"gb_per_s\": %.4f }%s\n",
+				result.Group.c_str(), result.Name.c_str(), result.Resolution.c_str(), result.Unit.c_str(), (unsigned long long)result.Items,
+				result.MilliSeconds, result.NanoSecondsPerItem, result.CyclesPerItem, result.GigaBytesPerSecond, i + 1 < _Results.size() ? "," : "");
+		}
+		std::fputs("  ]\n}\n", file);
+		return std::fclose(file) == 0;
+	}
+
+	bool Suite::WriteCsv(const std::string& InPath) const
+	{
+		FILE* file = std::fopen(InPath.c_str(), "wb");
+		if (file == nullptr)
+		{
+			return false;
+		}
+
+		std::fputs("group,name,resolution,unit,items,ms,ns_per_item,cycles_per_item,gb_per_s\n", file);
+		for (const Result& result : _Results)
+		{
+			std::fprintf(file, "%s,%s,%s,%s,%llu,%.6f,%.6f,%.6f,%.4f\n", result.Group.c_str(), result.Name.c_str(), result.Resolution.c_str(),
+				result.Unit.c_str(), (unsigned long long)result.Items, result.MilliSeconds, result.NanoSecondsPerItem, result.CyclesPerItem, result.GigaBytesPerSecond);
+		}
+		return std::fclose(file) == 0;
+	}
+
+	bool ParseOptions(int argc, char* argv[], Options& OutOptions)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string argument(argv[i]);
+			size_t separator = argument.find('=');
+			std::string key = argument.substr(0, separator);
+			std::string value = separator == std::string::npos ? "" : argument.substr(separator + 1);
+			if (key == "--iterations")
+			{
+				if (!BenchmarkUtil::ParseInt(value.c_str(), 1, OutOptions.Iterations))
+				{
+					return false;
+				}
+			}
+			else if (key == "--resolutions")
+			{
+				OutOptions.Resolutions.clear();
+				size_t begin = 0;
+				while (begin < value.size())
+				{
+					size_t end = value.find(',', begin);
+					end = end == std::string::npos ? value.size() : end;
+					int width = 0, height = 0;
+					if (std::sscanf(value.substr(begin, end - begin).c_str(), "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0)
+					{
+						return false;
+					}
+					OutOptions.Resolutions.emplace_back(width, height);
+					begin = end + 1;
+				}
+			}
+			else if (key == "--filter")
+			{
+				OutOptions.Filter = value;
+			}
+			else if (key == "--json")
+			{
+				OutOptions.JsonPath = value;
+			}
+			else if (key == "--csv")
+			{
+				OutOptions.CsvPath = value;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return OutOptions.Iterations > 0 && !OutOptions.Resolutions.empty();
+	}
+
+	void RunMath(Suite& InSuite)
+	{
+		// Small enough to stay in the L2 cache, so these measure the arithmetic.
+		const int count = 4096;
+		std::mt19937 random(13);
+		std::uniform_real_distribution<float> unit(-1.f, 1.f);
+		std::vector<Vector4> vectorsA(count), vectorsB(count), vectorsOut(count);
+		std::vector<Matrix4x4> matrices(count), matricesOut(count);
+		std::vector<float> x(count), y(count), z(count), outX(count), outY(count), outZ(count), outW(count);
+		for (int i = 0; i < count; ++i)
+		{
+			vectorsA[i] = Vector4(unit(random), unit(random), unit(random), unit(random));
+			vectorsB[i] = Vector4(unit(random), unit(random), unit(random), unit(random));
+			matrices[i] = Matrix4x4(vectorsA[i], vectorsB[i], vectorsA[(i + 1) % count], Vector4::UnitW);
+			x[i] = unit(random);
+			y[i] = unit(random);
+			z[i] = unit(random);
+		}
+		Matrix4x4 transform = matrices[0];
+
+		volatile float sink = 0.f;
+		InSuite.Run("math", "Vector4Add", "", "vector", count, count * sizeof(Vector4) * 3.0, [&]() {
+			for (int i = 0; i < count; ++i)
+			{
+				vectorsOut[i] = vectorsA[i] + vectorsB[i];
+			}
+		});
+		InSuite.Run("math", "Vector4Dot", "", "vector", count, count * sizeof(Vector4) * 2.0, [&]() {
+			float sum = 0.f;
+			for (int i = 0; i < count; ++i)
+			{
+				sum += vectorsA[i].Dot(vectorsB[i]);
+			}
+			sink = sum;
+		});
+		InSuite.Run("math", "Matrix4x4MulVector4", "", "vector", count, count * sizeof(Vector4) * 2.0, [&]() {
+			for (int i = 0; i < count; ++i)
+			{
+				vectorsOut[i] = transform * vectorsA[i];
+			}
+		});
+		InSuite.Run("math", "Matrix4x4MulMatrix4x4", "", "matrix", count, count * sizeof(Matrix4x4) * 2.0, [&]() {
+			for (int i = 0; i < count; ++i)
+			{
+				matricesOut[i] = transform * matrices[i];
+			}
+		});
+		InSuite.Run("math", "Matrix4x4Inverse", "", "matrix", count, count * sizeof(Matrix4x4) * 2.0, [&]() {
+			for (int i = 0; i < count; ++i)
+			{
+				matricesOut[i] = matrices[i].Inverse();
+			}
+		});
+		InSuite.Run("math", "TransformPointsSoA", "", "vector", count, count * sizeof(float) * 7.0, [&]() {
+			VertexTransform::TransformPoints(transform, x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), outW.data(), count);
+		});
+		sink = vectorsOut[count / 2].X + matricesOut[count / 2][1].Y + outW[count / 2];
+	}
+
+	void RunColor(Suite& InSuite)
+	{
+		const int count = 1 << 16;
+		std::mt19937 random(17);
+		std::vector<LinearColor> linearColors(count), decodedColors(count);
+		std::vector<Color32> colors(count), encodedColors(count);
+		for (int i = 0; i < count; ++i)
+		{
+			colors[i] = Color32((UINT32)random());
+			linearColors[i] = LinearColor(colors[i]);
+		}
+
+		InSuite.Run("color", "LinearToColor32", "", "color", count, count * (sizeof(LinearColor) + sizeof(Color32)), [&]() {
+			for (int i = 0; i < count; ++i)
+			{
+				encodedColors[i] = linearColors[i].ToColor32();
+			}
+		});
+		InSuite.Run("color", "Color32ToLinear", "", "color", count, count * (sizeof(LinearColor) + sizeof(Color32)), [&]() {
+			for (int i = 0; i < count; ++i)
+			{
+				decodedColors[i] = LinearColor(colors[i]);
+			}
+		});
+		InSuite.Run("color", "EncodeSRGB", "", "color", count, count * (sizeof(LinearColor) + sizeof(Color32)), [&]() {
+			ColorSpace::EncodeSRGB(linearColors.data(), encodedColors.data(), count);
+		});
+		InSuite.Run("color", "DecodeSRGB", "", "color", count, count * (sizeof(LinearColor) + sizeof(Color32)), [&]() {
+			ColorSpace::DecodeSRGB(colors.data(), decodedColors.data(), count);
+		});
+	}
+
+	void RunRenderer(Suite& InSuite, const ScreenPoint& InResolution)
+	{
+		HeadlessRSI renderer;
+		if (!renderer.Init(InResolution, RenderingSettings()))
+		{
+			std::fprintf(stderr, "Failed to create a %dx%d buffer.\n", InResolution.X, InResolution.Y);
+			return;
+		}
+
+		char resolution[32];
+		std::snprintf(resolution, sizeof(resolution), "%dx%d", InResolution.X, InResolution.Y);
+		UINT64 pixels = (UINT64)InResolution.X * InResolution.Y;
+		double colorBytes = (double)pixels * sizeof(Color32);
+		double depthBytes = (double)pixels * DepthBufferFormat::GetPixelSize(RenderingSettings().Depth);
+
+		// Every draw below covers each pixel once.
+		const LinearColor opaque(0.2f, 0.4f, 0.6f, 1.f);
+		const LinearColor translucent(0.8f, 0.3f, 0.1f, 0.5f);
+
+		InSuite.Run("renderer", "FillBuffer", resolution, "pixel", pixels, colorBytes, [&]() {
+			renderer.FillBuffer(Color32(10, 20, 30, 255));
+		});
+		InSuite.Run("renderer", "ClearDepthBuffer", resolution, "pixel", pixels, depthBytes, [&]() {
+			renderer.ClearDepthBuffer();
+		});
+		InSuite.Run("renderer", "HorizontalLines", resolution, "pixel", pixels, colorBytes, [&]() {
+			for (int y = 0; y < InResolution.Y; ++y)
+			{
+				renderer.DrawFullHorizontalLine(y, opaque);
+			}
+		});
+		InSuite.Run("renderer", "VerticalLines", resolution, "pixel", pixels, colorBytes, [&]() {
+			for (int x = 0; x < InResolution.X; ++x)
+			{
+				renderer.DrawFullVerticalLine(x, opaque);
+			}
+		});
+		InSuite.Run("renderer", "AlphaBlendRect", resolution, "pixel", pixels, colorBytes * 2.0, [&]() {
+			renderer.DrawFilledRect(ScreenPoint(0, 0), InResolution, translucent);
+		});
+		InSuite.Run("renderer", "AlphaBlendLines", resolution, "pixel", pixels, colorBytes * 2.0, [&]() {
+			for (int y = 0; y < InResolution.Y; ++y)
+			{
+				renderer.DrawFullHorizontalLine(y, translucent);
+			}
+		});
+
+		// Keeps the results observable.
+		volatile UINT32 center = renderer.GetScreenBuffer()[pixels / 2].GetColorRef();
+		(void)center;
+		renderer.Shutdown();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+	{
+		std::fprintf(stderr, "Invalid arguments.\n");
+		return -1;
+	}
+
+	std::printf("%s, %s, median of %d runs, %s\n", GetCompilerName(), GetSimdName(), options.Iterations, GetCycleCounterName());
+	std::printf("%-36s %10s %12s %12s %10s %8s\n", "case", "items", "ns/item", "cycles/item", "GB/s", "item");
+
+	Suite suite(options);
+	RunMath(suite);
+	RunColor(suite);
+	for (const ScreenPoint& resolution : options.Resolutions)
+	{
+		RunRenderer(suite, resolution);
+	}
+
+	if (!options.JsonPath.empty() && !suite.WriteJson(options.JsonPath))
+	{
+		std::fprintf(stderr, "Failed to write %s\n", options.JsonPath.c_str());
+		return -1;
+	}
+
+	if (!options.CsvPath.empty() && !suite.WriteCsv(options.CsvPath))
+	{
+		std::fprintf(stderr, "Failed to write %s\n", options.CsvPath.c_str());
+		return -1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+// Argument parsing and timing shared by the benchmark executables.
+namespace BenchmarkUtil
+{
+	typedef std::chrono::steady_clock Clock;
+
+	inline double GetElapsedMilliSeconds(Clock::time_point InStart)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - InStart).count();
+	}
+
+	// Runs InFunction InIterations times and returns the average time of one run.
+	template<typename Function>
+	double MeasureMilliSeconds(int InIterations, Function InFunction)
+	{
+		Clock::time_point start = Clock::now();
+		for (int iteration = 0; iteration < InIterations; ++iteration)
+		{
+			InFunction();
+		}
+		return GetElapsedMilliSeconds(start) / InIterations;
+	}
+
+	// A whole decimal number no smaller than InMinimum.
+	inline bool ParseInt(const char* InText, int InMinimum, int& OutValue)
+	{
+		char* end = nullptr;
+		long value = std::strtol(InText, &end, 10);
+		if (end == InText || *end != '\0' || value < InMinimum || value > INT_MAX)
+		{
+			return false;
+		}
+
+		OutValue = (int)value;
+		return true;
+	}
+
+	// A positional argument. The variable holds the default and receives the parsed value.
+	struct Argument
+	{
+		Argument(int& OutValue, int InMinimum) : Value(&OutValue), Minimum(InMinimum) { }
+
+		int* Value;
+		int Minimum;
+	};
+
+	// Reads the positional arguments in order, and missing ones keep their defaults.
+	// Reports the first invalid or extra argument and returns false.
+	inline bool ParseArguments(int argc, char* argv[], std::initializer_list<Argument> InArguments)
+	{
+		int index = 1;
+		for (const Argument& argument : InArguments)
+		{
+			if (index >= argc)
+			{
+				return true;
+			}
+
+			if (!ParseInt(argv[index], argument.Minimum, *argument.Value))
+			{
+				std::fprintf(stderr, "Invalid argument %d : %s\n", index, argv[index]);
+				return false;
+			}
+			index++;
+		}
+
+		if (index < argc)
+		{
+			std::fprintf(stderr, "Unexpected argument %d : %s\n", index, argv[index]);
+			return false;
+		}
+
+		return true;
+	}
+}
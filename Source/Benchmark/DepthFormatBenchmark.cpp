@@ -0,0 +1,174 @@
+#include "Precompiled.h"
+#include <random>
+
+// Usage : DepthFormatBenchmark [Width] [Height] [Iterations] [Triangles]
+// Clears the depth buffer and draws a set of overlapping depth tested triangles with every
+// depth format, and reports the clear bandwidth, the frame time and the depth traffic per frame.
+// Every format also draws a frame that reads and writes depth and fills the color buffer between
+// draws with both rasterizers, and the tile-binned one has to match the immediate one exactly.
+namespace
+{
+	struct Scene
+	{
+		std::vector<Vector3> Positions;
+		std::vector<LinearColor> Colors;
+	};
+
+	Scene CreateScene(int InWidth, int InHeight, int InTriangleCount)
+	{
+		// Depth stays inside [0, 1] so that every format sees the same scene.
+		std::mt19937 random(7);
+		std::uniform_real_distribution<float> unit(0.f, 1.f);
+		float size = (float)Math::Min(InWidth, InHeight) * 0.1f;
+
+		Scene scene;
+		for (int i = 0; i < InTriangleCount; ++i)
+		{
+			float centerX = (unit(random) - 0.5f) * InWidth;
+			float centerY = (unit(random) - 0.5f) * InHeight;
+			float depth = unit(random) * 0.9f;
+			LinearColor color(unit(random), unit(random), unit(random), 1.f);
+			for (int v = 0; v < 3; ++v)
+			{
+				scene.Positions.push_back(Vector3(centerX + (unit(random) - 0.5f) * size, centerY + (unit(random) - 0.5f) * size, depth + unit(random) * 0.1f));
+				scene.Colors.push_back(color);
+			}
+		}
+
+		return scene;
+	}
+
+	struct CheckFrame
+	{
+		std::vector<Color32> Pixels;
+		std::vector<float> Depths;
+	};
+
+	CheckFrame DrawCheckFrame(const Scene& InScene, const ScreenPoint& InScreenSize, int InTriangleCount, DepthFormat InFormat, RasterizerMode InRasterizer)
+	{
+		RenderingSettings settings;
+		settings.Depth = InFormat;
+		settings.Rasterizer = InRasterizer;
+
+		CheckFrame frame;
+		HeadlessRSI renderer;
+		if (!renderer.Init(InScreenSize, settings))
+		{
+			return frame;
+		}
+
+		// Depth reads, depth writes and fills land between draws that the tile-binned rasterizer defers.
+		int half = InTriangleCount / 2;
+		renderer.Clear(LinearColor::Black);
+		renderer.DrawTriangles(InScene.Positions.data(), InScene.Colors.data(), half);
+		for (int y = 0; y < InScreenSize.Y; y += 7)
+		{
+			ScreenPoint position(InScreenSize.X * y / InScreenSize.Y, y);
+			frame.Depths.push_back(renderer.GetDepthBufferValue(position));
+			renderer.SetDepthBufferValue(position, 1.f);
+		}
+		renderer.FillBuffer(Color32(32, 32, 32, 255));
+		renderer.DrawTriangles(InScene.Positions.data() + half * 3, InScene.Colors.data() + half * 3, InTriangleCount - half);
+		frame.Depths.push_back(renderer.GetDepthBufferValue(ScreenPoint(InScreenSize.X / 2, InScreenSize.Y / 2)));
+
+		const Color32* pixels = renderer.GetScreenBuffer();
+		frame.Pixels.assign(pixels, pixels + (size_t)InScreenSize.X * InScreenSize.Y);
+		return frame;
+	}
+
+	// Number of pixels and depth reads that differ between the two rasterizers.
+	size_t CountRasterizerMismatches(const Scene& InScene, const ScreenPoint& InScreenSize, int InTriangleCount, DepthFormat InFormat)
+	{
+		CheckFrame immediate = DrawCheckFrame(InScene, InScreenSize, InTriangleCount, InFormat, RasterizerMode::Immediate);
+		CheckFrame tiled = DrawCheckFrame(InScene, InScreenSize, InTriangleCount, InFormat, RasterizerMode::TileBinned);
+		if (immediate.Pixels.empty() || immediate.Pixels.size() != tiled.Pixels.size())
+		{
+			return (size_t)InScreenSize.X * InScreenSize.Y;
+		}
+
+		size_t mismatches = 0;
+		for (size_t i = 0; i < immediate.Pixels.size(); ++i)
+		{
+			mismatches += immediate.Pixels[i].GetColorRef() != tiled.Pixels[i].GetColorRef() ? 1 : 0;
+		}
+		for (size_t i = 0; i < immediate.Depths.size(); ++i)
+		{
+			mismatches += immediate.Depths[i] != tiled.Depths[i] ? 1 : 0;
+		}
+		return mismatches;
+	}
+
+	const char* GetFormatName(DepthFormat InFormat)
+	{
+		switch (InFormat)
+		{
+		case DepthFormat::D24S8:
+			return "D24S8";
+		case DepthFormat::D16:
+			return "D16";
+		default:
+			return "D32F";
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int width = 1920;
+	int height = 1080;
+	int iterations = 20;
+	int triangleCount = 20000;
+	if (!BenchmarkUtil::ParseArguments(argc, argv, { { width, 1 }, { height, 1 }, { iterations, 1 }, { triangleCount, 1 } }))
+	{
+		return -1;
+	}
+
+	Scene scene = CreateScene(width, height, triangleCount);
+	std::printf("%dx%d, %d iterations, %d triangles\n", width, height, iterations, triangleCount);
+	std::printf("%8s %8s %10s %10s %10s %12s %12s %14s %16s\n", "format", "bytes", "buffer MB", "clear ms", "clear GB/s", "ms/frame", "Mtri/s", "depth MB/frame", "tiled mismatches");
+
+	size_t totalMismatches = 0;
+	const DepthFormat formats[] = { DepthFormat::D32F, DepthFormat::D24S8, DepthFormat::D16 };
+	for (DepthFormat format : formats)
+	{
+		RenderingSettings settings;
+		settings.Depth = format;
+
+		HeadlessRSI renderer;
+		if (!renderer.Init(ScreenPoint(width, height), settings))
+		{
+			std::fprintf(stderr, "Failed to create a %dx%d buffer.\n", width, height);
+			return -1;
+		}
+
+		UINT32 pixelSize = DepthBufferFormat::GetPixelSize(format);
+		double bufferBytes = (double)width * height * pixelSize;
+
+		// Warm up the buffers before timing.
+		renderer.ClearDepthBuffer();
+		double clearTime = BenchmarkUtil::MeasureMilliSeconds(iterations, [&renderer]() { renderer.ClearDepthBuffer(); });
+
+		renderer.Clear(LinearColor::Black);
+		renderer.DrawTriangles(scene.Positions.data(), scene.Colors.data(), triangleCount);
+		renderer.ResetDepthCullStatistics();
+		double frameTime = BenchmarkUtil::MeasureMilliSeconds(iterations, [&]() {
+			renderer.Clear(LinearColor::Black);
+			renderer.DrawTriangles(scene.Positions.data(), scene.Colors.data(), triangleCount);
+			renderer.GetScreenBuffer();
+		});
+
+		// Every rasterized block reads and writes back its depth values, and the clear writes the whole buffer once.
+		DepthCullStatistics statistics = renderer.GetDepthCullStatistics();
+		double blockBytes = (double)TriangleRasterizer::BlockSize * TriangleRasterizer::BlockSize * pixelSize * 2.0;
+		double depthTraffic = (double)statistics.RasterizedBlocks / iterations * blockBytes + bufferBytes;
+
+		size_t mismatches = CountRasterizerMismatches(scene, ScreenPoint(width, height), triangleCount, format);
+		totalMismatches += mismatches;
+
+		std::printf("%8s %8u %10.2f %10.3f %10.2f %12.3f %12.2f %14.2f %16zu\n", GetFormatName(format), pixelSize,
+			bufferBytes / (1024.0 * 1024.0), clearTime, bufferBytes / (clearTime * 1.0e6), frameTime,
+			triangleCount / (frameTime * 1000.0), depthTraffic / (1024.0 * 1024.0), mismatches);
+	}
+
+	return totalMismatches == 0 ? 0 : 1;
+}
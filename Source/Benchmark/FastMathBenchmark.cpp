@@ -0,0 +1,135 @@
+#include "Precompiled.h"
+#include <cmath>
+#include <random>
+#include <type_traits>
+
+// Usage : FastMathBenchmark [Count] [Iterations]
+// Times libm, the scalar fast math functions and their batch versions over the same inputs,
+// and reports the largest error of the fast versions against double precision libm.
+// Fails when an error is above the bound documented in MathUtil.h.
+namespace
+{
+	// Inputs are drawn uniformly from [InMin, InMax], or over exponents when InMin is positive.
+	// The second input is used by atan2 only. Functions without a scalar version pass nullptr for it.
+	// Returns whether the errors are within InMaxError.
+	template<class Reference, class Precise, class Fast, class Batch>
+	bool Run(const char* InName, float InMin, float InMax, bool InIsRelativeError, double InMaxError, int InCount, int InIterations,
+		Reference InReference, Precise InPrecise, Fast InFast, Batch InBatch)
+	{
+		constexpr bool hasScalar = !std::is_null_pointer<Fast>::value;
+		std::mt19937 random(3);
+		bool isLogarithmic = InMin > 0.f;
+		std::uniform_real_distribution<float> distribution(isLogarithmic ? logf(InMin) : InMin, isLogarithmic ? logf(InMax) : InMax);
+		std::vector<float> first(InCount), second(InCount), output(InCount);
+		for (int i = 0; i < InCount; ++i)
+		{
+			first[i] = isLogarithmic ? expf(distribution(random)) : distribution(random);
+			second[i] = distribution(random);
+		}
+
+		volatile float sink = 0.f;
+		double preciseTime = BenchmarkUtil::MeasureMilliSeconds(InIterations, [&]() {
+			float sum = 0.f;
+			for (int i = 0; i < InCount; ++i)
+			{
+				sum += InPrecise(first[i], second[i]);
+			}
+			sink = sum;
+		});
+		double fastTime = 0.0;
+		if constexpr (hasScalar)
+		{
+			fastTime = BenchmarkUtil::MeasureMilliSeconds(InIterations, [&]() {
+				float sum = 0.f;
+				for (int i = 0; i < InCount; ++i)
+				{
+					sum += InFast(first[i], second[i]);
+				}
+				sink = sum;
+			});
+		}
+		double batchTime = BenchmarkUtil::MeasureMilliSeconds(InIterations, [&]() { InBatch(first.data(), second.data(), output.data(), InCount); });
+
+		double fastError = 0.0;
+		double batchError = 0.0;
+		for (int i = 0; i < InCount; ++i)
+		{
+			double reference = InReference(first[i], second[i]);
+			double scale = InIsRelativeError ? 1.0 / std::fabs(reference) : 1.0;
+			if constexpr (hasScalar)
+			{
+				fastError = Math::Max(fastError, std::fabs(InFast(first[i], second[i]) - reference) * scale);
+			}
+			batchError = Math::Max(batchError, std::fabs(output[i] - reference) * scale);
+		}
+
+		bool isPassed = fastError <= InMaxError && batchError <= InMaxError;
+		double toNanoSeconds = 1e6 / InCount;
+		if (hasScalar)
+		{
+			std::printf("%8s %12.2f %12.2f %12.2f %14.3g %14.3g %10.3g%s%s\n", InName, preciseTime * toNanoSeconds, fastTime * toNanoSeconds, batchTime * toNanoSeconds,
+				fastError, batchError, InMaxError, InIsRelativeError ? " (relative)" : "", isPassed ? "" : " FAILED");
+		}
+		else
+		{
+			std::printf("%8s %12.2f %12s %12.2f %14s %14.3g %10.3g%s%s\n", InName, preciseTime * toNanoSeconds, "-", batchTime * toNanoSeconds,
+				"-", batchError, InMaxError, InIsRelativeError ? " (relative)" : "", isPassed ? "" : " FAILED");
+		}
+		return isPassed;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int count = 65536;
+	int iterations = 200;
+	if (!BenchmarkUtil::ParseArguments(argc, argv, { { count, 1 }, { iterations, 1 } }))
+	{
+		return -1;
+	}
+
+	std::printf("%d values, %d iterations\n", count, iterations);
+	std::printf("%8s %12s %12s %12s %14s %14s %10s\n", "function", "libm ns", "fast ns", "batch ns", "fast error", "batch error", "bound");
+
+	// Bounds documented in MathUtil.h.
+#if defined(MATH_SIMD_SSE2)
+	const double invSqrtMaxError = 4.8e-7;
+#else
+	const double invSqrtMaxError = 4.8e-6;
+#endif
+
+	std::vector<float> unused(count);
+	bool isPassed = true;
+	isPassed &= Run("sin", -1e4f, 1e4f, false, 1.2e-7, count, iterations,
+		[](double x, double) { return std::sin(x); },
+		[](float x, float) { return sinf(x); },
+		[](float x, float) { return Math::FastSin(x); },
+		[&](const float* x, const float*, float* out, int n) { Math::FastSinCos(x, out, unused.data(), n); });
+	isPassed &= Run("cos", -1e4f, 1e4f, false, 1.2e-7, count, iterations,
+		[](double x, double) { return std::cos(x); },
+		[](float x, float) { return cosf(x); },
+		[](float x, float) { return Math::FastCos(x); },
+		[&](const float* x, const float*, float* out, int n) { Math::FastSinCos(x, unused.data(), out, n); });
+	isPassed &= Run("atan2", -100.f, 100.f, false, 2.1e-7, count, iterations,
+		[](double y, double x) { return std::atan2(y, x); },
+		[](float y, float x) { return atan2f(y, x); },
+		[](float y, float x) { return Math::FastAtan2(y, x); },
+		[](const float* y, const float* x, float* out, int n) { Math::FastAtan2(y, x, out, n); });
+	isPassed &= Run("invsqrt", 1e-6f, 1e6f, true, invSqrtMaxError, count, iterations,
+		[](double x, double) { return 1.0 / std::sqrt(x); },
+		[](float x, float) { return Math::InvSqrt(x); },
+		[](float x, float) { return Math::FastInvSqrt(x); },
+		[](const float* x, const float*, float* out, int n) { Math::FastInvSqrt(x, out, n); });
+	isPassed &= Run("exp", -80.f, 80.f, true, 2.0e-7, count, iterations,
+		[](double x, double) { return std::exp(x); },
+		[](float x, float) { return expf(x); },
+		nullptr,
+		[](const float* x, const float*, float* out, int n) { Math::FastExp(x, out, n); });
+	isPassed &= Run("log", 1e-30f, 1e30f, false, 1.2e-7, count, iterations,
+		[](double x, double) { return std::log(x); },
+		[](float x, float) { return logf(x); },
+		nullptr,
+		[](const float* x, const float*, float* out, int n) { Math::FastLog(x, out, n); });
+
+	return isPassed ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#include "Precompiled.h"
+
+// Usage : JobSystemBenchmark [Width] [Height] [Iterations] [MaxThreads]
+// Shades every pixel of an image with a fixed amount of arithmetic and reports how the
+// frame time scales from one thread up to the given thread count.
+namespace
+{
+	Color32 ShadePixel(int InX, int InY, int InWidth, int InHeight)
+	{
+		// A few escape-time steps give each pixel a small, uneven amount of work.
+		float cx = (float)InX / InWidth * 3.f - 2.f;
+		float cy = (float)InY / InHeight * 2.f - 1.f;
+		float zx = 0.f;
+		float zy = 0.f;
+		int step = 0;
+		for (; step < 64 && zx * zx + zy * zy < 4.f; ++step)
+		{
+			float nextX = zx * zx - zy * zy + cx;
+			zy = 2.f * zx * zy + cy;
+			zx = nextX;
+		}
+
+		BYTE value = (BYTE)(step * 4);
+		return Color32(value, value, value, 255);
+	}
+
+	double RenderFrames(JobSystem& InJobSystem, std::vector<Color32>& InImage, int InWidth, int InHeight, int InIterations)
+	{
+		return BenchmarkUtil::MeasureMilliSeconds(InIterations, [&]() {
+			InJobSystem.ParallelFor(0, InHeight, 4, [&](int InBegin, int InEnd) {
+				for (int y = InBegin; y < InEnd; ++y)
+				{
+					Color32* row = InImage.data() + (size_t)y * InWidth;
+					for (int x = 0; x < InWidth; ++x)
+					{
+						row[x] = ShadePixel(x, y, InWidth, InHeight);
+					}
+				}
+			});
+		});
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int width = 1920;
+	int height = 1080;
+	int iterations = 10;
+	int maxThreads = (int)JobSystem::GetDefaultWorkerCount() + 1;
+	if (!BenchmarkUtil::ParseArguments(argc, argv, { { width, 1 }, { height, 1 }, { iterations, 1 }, { maxThreads, 1 } }))
+	{
+		return -1;
+	}
+
+	std::vector<Color32> image((size_t)width * height);
+	std::printf("%dx%d, %d iterations\n", width, height, iterations);
+	std::printf("%8s %12s %12s %10s %10s\n", "threads", "ms/frame", "Mpixel/s", "speedup", "efficiency");
+
+	double singleThreadTime = 0.0;
+	for (int threadCount = 1; threadCount <= maxThreads; ++threadCount)
+	{
+		JobSystem jobSystem;
+		jobSystem.Start(threadCount - 1);
+
+		// Warm up the workers and the image memory before timing.
+		RenderFrames(jobSystem, image, width, height, 1);
+		double frameTime = RenderFrames(jobSystem, image, width, height, iterations);
+		if (threadCount == 1)
+		{
+			singleThreadTime = frameTime;
+		}
+
+		double speedup = singleThreadTime / frameTime;
+		std::printf("%8d %12.3f %12.2f %10.2f %9.0f%%\n", threadCount, frameTime,
+			(double)width * height / (frameTime * 1000.0), speedup, speedup / threadCount * 100.0);
+	}
+
+	return 0;
+}
@@ -0,0 +1,84 @@
+#include "Precompiled.h"
+#include <random>
+
+// Usage : MatrixInverseBenchmark [Matrices] [Iterations]
+// Inverts a set of rigid transforms with every Matrix4x4 inverse that applies to them,
+// and reports the time per matrix and the largest deviation of M * Inverse(M) from identity.
+// Fails when any deviation exceeds MaxError.
+namespace
+{
+	constexpr float MaxError = 1e-3f;
+
+	// Returns false when the inverses are off by more than MaxError.
+	template<class Function>
+	bool Run(const char* InName, const std::vector<Matrix4x4>& InMatrices, std::vector<Matrix4x4>& OutInverses, int InIterations, Function InInverse)
+	{
+		double milliSeconds = BenchmarkUtil::MeasureMilliSeconds(InIterations, [&]() {
+			for (size_t i = 0; i < InMatrices.size(); ++i)
+			{
+				OutInverses[i] = InInverse(InMatrices[i]);
+			}
+		});
+
+		float maxError = 0.f;
+		for (size_t i = 0; i < InMatrices.size(); ++i)
+		{
+			Matrix4x4 product = InMatrices[i] * OutInverses[i];
+			for (BYTE column = 0; column < Matrix4x4::Rank; ++column)
+			{
+				Vector4 difference = product[column] - Matrix4x4::Identity[column];
+				maxError = Math::Max(maxError, Math::Max(Math::Abs(difference.X), Math::Max(Math::Abs(difference.Y), Math::Max(Math::Abs(difference.Z), Math::Abs(difference.W)))));
+			}
+		}
+
+		std::printf("%14s %12.2f %14.3g\n", InName, milliSeconds * 1e6 / InMatrices.size(), maxError);
+		return maxError <= MaxError;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int matrixCount = 4096;
+	int iterations = 500;
+	if (!BenchmarkUtil::ParseArguments(argc, argv, { { matrixCount, 1 }, { iterations, 1 } }))
+	{
+		return -1;
+	}
+
+	// Rotation about Z then X, followed by a translation : valid input for every path but the projections.
+	std::mt19937 random(5);
+	std::uniform_real_distribution<float> angle(-Math::PI, Math::PI);
+	std::uniform_real_distribution<float> offset(-100.f, 100.f);
+	std::vector<Matrix4x4> rigids(matrixCount), projections(matrixCount), inverses(matrixCount);
+	for (int i = 0; i < matrixCount; ++i)
+	{
+		float sinZ, cosZ, sinX, cosX;
+		Math::GetSinCos(sinZ, cosZ, angle(random) * 180.f / Math::PI);
+		Math::GetSinCos(sinX, cosX, angle(random) * 180.f / Math::PI);
+		Matrix4x4 rotationZ(Vector4(cosZ, sinZ, 0.f, 0.f), Vector4(-sinZ, cosZ, 0.f, 0.f), Vector4::UnitZ, Vector4::UnitW);
+		Matrix4x4 rotationX(Vector4::UnitX, Vector4(0.f, cosX, sinX, 0.f), Vector4(0.f, -sinX, cosX, 0.f), Vector4::UnitW);
+		rigids[i] = rotationZ * rotationX;
+		rigids[i][3] = Vector4(offset(random), offset(random), offset(random), 1.f);
+
+		// Off-center perspective with a random field of view and depth range.
+		float nearZ = 0.1f + Math::Abs(offset(random)) * 0.01f;
+		float farZ = nearZ + 10.f + Math::Abs(offset(random));
+		float focal = 1.f + Math::Abs(offset(random)) * 0.02f;
+		projections[i] = Matrix4x4(
+			Vector4(focal, 0.f, 0.f, 0.f),
+			Vector4(0.f, focal * 1.5f, 0.f, 0.f),
+			Vector4(offset(random) * 0.001f, offset(random) * 0.001f, (farZ + nearZ) / (nearZ - farZ), -1.f),
+			Vector4(0.f, 0.f, 2.f * farZ * nearZ / (nearZ - farZ), 0.f)
+		);
+	}
+
+	std::printf("%d matrices, %d iterations\n", matrixCount, iterations);
+	std::printf("%14s %12s %14s\n", "inverse", "ns/matrix", "max error");
+	bool isAccurate = true;
+	isAccurate &= Run("general", rigids, inverses, iterations, [](const Matrix4x4& InMatrix) { return InMatrix.Inverse(); });
+	isAccurate &= Run("affine", rigids, inverses, iterations, [](const Matrix4x4& InMatrix) { return InMatrix.InverseAffine(); });
+	isAccurate &= Run("rigid", rigids, inverses, iterations, [](const Matrix4x4& InMatrix) { return InMatrix.InverseRigid(); });
+	isAccurate &= Run("general proj", projections, inverses, iterations, [](const Matrix4x4& InMatrix) { return InMatrix.Inverse(); });
+	isAccurate &= Run("perspective", projections, inverses, iterations, [](const Matrix4x4& InMatrix) { return InMatrix.InversePerspective(); });
+	return isAccurate ? 0 : 1;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#if defined(PLATFORM_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <memory>
+
+#include "MathHeaders.h"
+#include "EngineHeaders.h"
+#include "RendererHeaders.h"
+
+using namespace CK;
+
+#include "BenchmarkUtil.h"
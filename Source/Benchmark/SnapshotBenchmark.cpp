@@ -0,0 +1,107 @@
+#include "Precompiled.h"
+
+// Usage : SnapshotBenchmark [Publishes] [Floats per state]
+// A writer thread publishes states whose every value is the publish number while the main thread keeps
+// reading the latest one, once through SnapshotBuffer and once through a mutex guarded copy.
+// A read whose values do not all match its publish number is torn, and there should be none.
+namespace
+{
+	struct BenchmarkState
+	{
+		UINT64 Sequence = 0;
+		std::vector<float> Values;
+	};
+
+	struct RunResult
+	{
+		double PublishNanoSeconds = 0.0;
+		UINT64 ReadCount = 0;
+		UINT64 SeenCount = 0;
+		UINT64 TornCount = 0;
+	};
+
+	bool IsTorn(const BenchmarkState& InState)
+	{
+		for (float value : InState.Values)
+		{
+			if (value != (float)(InState.Sequence & 0xFFFFFF))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void FillState(BenchmarkState& OutState, UINT64 InSequence)
+	{
+		OutState.Sequence = InSequence;
+		std::fill(OutState.Values.begin(), OutState.Values.end(), (float)(InSequence & 0xFFFFFF));
+	}
+
+	template<typename WriteFunction, typename ReadFunction>
+	RunResult Run(int InPublishCount, WriteFunction InWrite, ReadFunction InRead)
+	{
+		RunResult result;
+		std::atomic<bool> done{ false };
+		std::thread writer([&]() {
+			BenchmarkUtil::Clock::time_point start = BenchmarkUtil::Clock::now();
+			for (int i = 1; i <= InPublishCount; ++i)
+			{
+				InWrite((UINT64)i);
+			}
+			result.PublishNanoSeconds = BenchmarkUtil::GetElapsedMilliSeconds(start) * 1e6 / InPublishCount;
+			done.store(true, std::memory_order_release);
+		});
+
+		UINT64 lastSequence = 0;
+		while (!done.load(std::memory_order_acquire))
+		{
+			const BenchmarkState& state = InRead();
+			result.ReadCount++;
+			result.TornCount += IsTorn(state) ? 1 : 0;
+			if (state.Sequence != lastSequence)
+			{
+				result.SeenCount++;
+				lastSequence = state.Sequence;
+			}
+		}
+
+		writer.join();
+		return result;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int publishCount = 200000;
+	int floatCount = 256;
+	if (!BenchmarkUtil::ParseArguments(argc, argv, { { publishCount, 1 }, { floatCount, 1 } }))
+	{
+		return -1;
+	}
+
+	BenchmarkState initialState;
+	initialState.Values.assign(floatCount, 0.f);
+
+	// Every slot owns its values up front, so nothing is allocated while publishing.
+	SnapshotBuffer<BenchmarkState> snapshots(initialState);
+	RunResult snapshotResult = Run(publishCount,
+		[&snapshots](UINT64 InSequence) { FillState(snapshots.GetWriteState(), InSequence); snapshots.Publish(); },
+		[&snapshots]() -> const BenchmarkState& { return snapshots.AcquireLatest(); });
+
+	std::mutex mutex;
+	BenchmarkState writeState = initialState;
+	BenchmarkState sharedState = initialState;
+	BenchmarkState readState = initialState;
+	RunResult mutexResult = Run(publishCount,
+		[&](UINT64 InSequence) { FillState(writeState, InSequence); std::lock_guard<std::mutex> lock(mutex); sharedState.Sequence = writeState.Sequence; sharedState.Values = writeState.Values; },
+		[&]() -> const BenchmarkState& { std::lock_guard<std::mutex> lock(mutex); readState.Sequence = sharedState.Sequence; readState.Values = sharedState.Values; return readState; });
+
+	std::printf("%d publishes of %d floats, %u hardware threads\n", publishCount, floatCount, std::thread::hardware_concurrency());
+	std::printf("%10s %14s %12s %12s %8s\n", "handoff", "ns/publish", "reads", "seen", "torn");
+	std::printf("%10s %14.1f %12llu %12llu %8llu\n", "snapshot", snapshotResult.PublishNanoSeconds,
+		(unsigned long long)snapshotResult.ReadCount, (unsigned long long)snapshotResult.SeenCount, (unsigned long long)snapshotResult.TornCount);
+	std::printf("%10s %14.1f %12llu %12llu %8llu\n", "mutex", mutexResult.PublishNanoSeconds,
+		(unsigned long long)mutexResult.ReadCount, (unsigned long long)mutexResult.SeenCount, (unsigned long long)mutexResult.TornCount);
+	return snapshotResult.TornCount == 0 ? 0 : 1;
+}
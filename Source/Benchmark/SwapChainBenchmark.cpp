@@ -0,0 +1,123 @@
+#include "Precompiled.h"
+#include <cstring>
+#include <random>
+
+// Usage : SwapChainBenchmark [Width] [Height] [Frames] [Triangles] [Present copies]
+// Draws a scene of depth tested triangles every frame and presents it through a callback that copies
+// the frame out the given number of times, as a stand-in for a readback or an encoder. The frame time
+// with one buffer is the sum of drawing and presenting, and with more buffers the present runs on its
+// own thread, so it should approach the slower of the two when there is a spare core.
+namespace
+{
+	struct Scene
+	{
+		std::vector<Vector3> Positions;
+		std::vector<LinearColor> Colors;
+	};
+
+	Scene CreateScene(int InWidth, int InHeight, int InTriangleCount)
+	{
+		std::mt19937 random(5);
+		std::uniform_real_distribution<float> unit(0.f, 1.f);
+		float size = (float)Math::Min(InWidth, InHeight) * 0.1f;
+
+		Scene scene;
+		for (int i = 0; i < InTriangleCount; ++i)
+		{
+			float centerX = (unit(random) - 0.5f) * InWidth;
+			float centerY = (unit(random) - 0.5f) * InHeight;
+			float depth = unit(random) * 0.9f;
+			LinearColor color(unit(random), unit(random), unit(random), 1.f);
+			for (int v = 0; v < 3; ++v)
+			{
+				scene.Positions.push_back(Vector3(centerX + (unit(random) - 0.5f) * size, centerY + (unit(random) - 0.5f) * size, depth + unit(random) * 0.1f));
+				scene.Colors.push_back(color);
+			}
+		}
+
+		return scene;
+	}
+
+	void CopyOut(const Color32* InPixels, const ScreenPoint& InScreenSize, std::vector<Color32>& OutStaging, int InCopyCount)
+	{
+		size_t byteCount = (size_t)InScreenSize.X * InScreenSize.Y * sizeof(Color32);
+		for (int i = 0; i < InCopyCount; ++i)
+		{
+			std::memcpy(OutStaging.data(), InPixels, byteCount);
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int width = 1280;
+	int height = 720;
+	int frameCount = 200;
+	int triangleCount = 2000;
+	int copyCount = 8;
+	if (!BenchmarkUtil::ParseArguments(argc, argv, { { width, 1 }, { height, 1 }, { frameCount, 1 }, { triangleCount, 0 }, { copyCount, 0 } }))
+	{
+		return -1;
+	}
+
+	Scene scene = CreateScene(width, height, triangleCount);
+	ScreenPoint screenSize(width, height);
+	std::vector<Color32> staging((size_t)width * height);
+
+	// Both halves alone, for the bound that the pipelined runs are compared with.
+	double drawMilliSeconds = 0.0;
+	{
+		HeadlessRSI renderer;
+		if (!renderer.Init(screenSize, RenderingSettings()))
+		{
+			std::fprintf(stderr, "Failed to create a %dx%d buffer.\n", width, height);
+			return -1;
+		}
+
+		drawMilliSeconds = BenchmarkUtil::MeasureMilliSeconds(frameCount, [&]() {
+			renderer.Clear(LinearColor::White);
+			renderer.DrawTriangles(scene.Positions.data(), scene.Colors.data(), triangleCount);
+			renderer.EndFrame();
+		});
+
+		double presentMilliSeconds = BenchmarkUtil::MeasureMilliSeconds(frameCount, [&]() {
+			CopyOut(renderer.GetScreenBuffer(), screenSize, staging, copyCount);
+		});
+
+		std::printf("%dx%d, %d frames, %d triangles, %d copies per present\n", width, height, frameCount, triangleCount, copyCount);
+		std::printf("draw %.3f ms, present %.3f ms : sum %.3f ms, max %.3f ms\n", drawMilliSeconds, presentMilliSeconds,
+			drawMilliSeconds + presentMilliSeconds, Math::Max(drawMilliSeconds, presentMilliSeconds));
+	}
+
+	std::printf("%8s %10s %10s %12s %12s %10s %10s %12s\n", "buffers", "ms/frame", "fps", "latency ms", "max lat ms", "avg depth", "max depth", "stall ms");
+	for (UINT32 bufferCount = 1; bufferCount <= 3; ++bufferCount)
+	{
+		RenderingSettings settings;
+		settings.BufferCount = bufferCount;
+
+		HeadlessRSI renderer;
+		renderer.SetPresentCallback([&staging, copyCount](const Color32* InPixels, const ScreenPoint& InScreenSize) { CopyOut(InPixels, InScreenSize, staging, copyCount); });
+		if (!renderer.Init(screenSize, settings))
+		{
+			std::fprintf(stderr, "Failed to create a %dx%d buffer.\n", width, height);
+			return -1;
+		}
+
+		BenchmarkUtil::Clock::time_point start = BenchmarkUtil::Clock::now();
+		for (int frame = 0; frame < frameCount; ++frame)
+		{
+			renderer.Clear(LinearColor::White);
+			renderer.DrawTriangles(scene.Positions.data(), scene.Colors.data(), triangleCount);
+			renderer.EndFrame();
+		}
+		renderer.WaitForPresents();
+		double frameMilliSeconds = BenchmarkUtil::GetElapsedMilliSeconds(start) / frameCount;
+
+		SwapChainStatistics statistics = renderer.GetSwapChainStatistics();
+		std::printf("%8u %10.3f %10.1f %12.3f %12.3f %10.2f %10u %12.3f\n", bufferCount, frameMilliSeconds, 1000.0 / frameMilliSeconds,
+			statistics.AverageLatencyMilliSeconds, statistics.MaxLatencyMilliSeconds, statistics.AverageQueueDepth, statistics.MaxQueueDepth,
+			statistics.StallMilliSeconds);
+	}
+
+	return 0;
+}
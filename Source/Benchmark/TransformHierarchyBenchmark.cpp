@@ -0,0 +1,91 @@
+#include "Precompiled.h"
+#include <random>
+
+// Usage : TransformHierarchyBenchmark [Nodes] [Frames] [Moved nodes per frame]
+// Animates a random forest of transforms and compares rebuilding every world matrix each frame
+// with TransformHierarchy, which only rebuilds the subtrees of the moved nodes.
+// The largest difference between the cached and the fully rebuilt world matrices is printed last,
+// and the run fails when it exceeds MaxError.
+namespace
+{
+	constexpr float MaxError = 1e-3f;
+
+	void RebuildAll(const TransformHierarchy& InHierarchy, std::vector<Matrix4x4>& OutWorlds)
+	{
+		for (int i = 0; i < InHierarchy.GetNodeCount(); ++i)
+		{
+			int parent = InHierarchy.GetParent(i);
+			Matrix4x4 local = InHierarchy.GetLocalTransform(i).GetMatrix();
+			OutWorlds[i] = (parent == TransformHierarchy::InvalidIndex) ? local : OutWorlds[parent] * local;
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int nodeCount = 10000;
+	int frameCount = 500;
+	int movedCount = 16;
+	if (!BenchmarkUtil::ParseArguments(argc, argv, { { nodeCount, 1 }, { frameCount, 1 }, { movedCount, 0 } }))
+	{
+		return -1;
+	}
+
+	// Shallow random trees : most nodes hang off one of the recently added ones.
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> offset(-10.f, 10.f);
+	std::uniform_real_distribution<float> angle(-180.f, 180.f);
+	TransformHierarchy hierarchy;
+	hierarchy.Reserve(nodeCount);
+	for (int i = 0; i < nodeCount; ++i)
+	{
+		int parent = TransformHierarchy::InvalidIndex;
+		if (i > 0 && random() % 16 != 0)
+		{
+			parent = Math::Max(0, i - 1 - (int)(random() % 64));
+		}
+
+		Vector3 axis = Vector3(offset(random), offset(random), offset(random)).Normalize();
+		hierarchy.AddNode(Transform(Vector3(offset(random), offset(random), offset(random)), Quaternion(axis, angle(random)), Vector3(1.f, 1.f, 1.f)), parent);
+	}
+	hierarchy.Update();
+
+	std::vector<int> moved(movedCount);
+	std::vector<Quaternion> spins(movedCount);
+	for (int i = 0; i < movedCount; ++i)
+	{
+		moved[i] = (int)(random() % nodeCount);
+		spins[i] = Quaternion(Vector3::UnitY, 2.f);
+	}
+
+	std::vector<Matrix4x4> worlds(nodeCount);
+	double fullMilliSeconds = BenchmarkUtil::MeasureMilliSeconds(frameCount, [&]() { RebuildAll(hierarchy, worlds); });
+
+	INT64 updatedCount = 0;
+	double cachedMilliSeconds = BenchmarkUtil::MeasureMilliSeconds(frameCount, [&]() {
+		for (int i = 0; i < movedCount; ++i)
+		{
+			hierarchy.SetRotation(moved[i], spins[i] * hierarchy.GetLocalTransform(moved[i]).Rotation);
+		}
+		hierarchy.Update();
+		updatedCount += hierarchy.GetLastUpdatedCount();
+	});
+
+	RebuildAll(hierarchy, worlds);
+	float maxError = 0.f;
+	for (int i = 0; i < nodeCount; ++i)
+	{
+		for (BYTE column = 0; column < Matrix4x4::Rank; ++column)
+		{
+			Vector4 difference = hierarchy.GetWorldMatrix(i)[column] - worlds[i][column];
+			maxError = Math::Max(maxError, Math::Max(Math::Abs(difference.X), Math::Max(Math::Abs(difference.Y), Math::Max(Math::Abs(difference.Z), Math::Abs(difference.W)))));
+		}
+	}
+
+	std::printf("%d nodes, %d frames, %d moved per frame\n", nodeCount, frameCount, movedCount);
+	std::printf("%10s %12s %16s\n", "update", "ms/frame", "nodes/frame");
+	std::printf("%10s %12.4f %16d\n", "full", fullMilliSeconds, nodeCount);
+	std::printf("%10s %12.4f %16.1f\n", "cached", cachedMilliSeconds, (double)updatedCount / frameCount);
+	std::printf("max error %g\n", maxError);
+	return maxError <= MaxError ? 0 : 1;
+}
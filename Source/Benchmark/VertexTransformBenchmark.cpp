@@ -0,0 +1,88 @@
+#include "Precompiled.h"
+#include <random>
+
+// Usage : VertexTransformBenchmark [Vertices] [Iterations] [Width] [Height]
+// Projects a cloud of points to the screen one at a time through Matrix4x4 and in a batch through
+// VertexTransform, and reports the time per frame and the largest difference between the two.
+// Both paths round differently, so vertices right on a pixel edge can land on neighbouring pixels,
+// and the run fails when any position differs by more than MaxError pixels instead.
+namespace
+{
+	constexpr float MaxError = 1.f / 64.f;
+
+	// Perspective projection to normalized coordinates, camera looking down -Z.
+	Matrix4x4 CreateViewProjection(float InAspect)
+	{
+		float focal = 1.f / tanf(Math::Deg2Rad(60.f) * 0.5f);
+		float nearZ = 0.1f, farZ = 100.f;
+		float rangeInv = 1.f / (nearZ - farZ);
+		return Matrix4x4(
+			Vector4(focal / InAspect, 0.f, 0.f, 0.f),
+			Vector4(0.f, focal, 0.f, 0.f),
+			Vector4(0.f, 0.f, (farZ + nearZ) * rangeInv, -1.f),
+			Vector4(0.f, 0.f, 2.f * farZ * nearZ * rangeInv, 0.f)
+		);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	int vertexCount = 1000000;
+	int iterations = 50;
+	int width = 1920;
+	int height = 1080;
+	if (!BenchmarkUtil::ParseArguments(argc, argv, { { vertexCount, 1 }, { iterations, 1 }, { width, 1 }, { height, 1 } }))
+	{
+		return -1;
+	}
+
+	std::mt19937 random(11);
+	std::uniform_real_distribution<float> side(-10.f, 10.f);
+	std::uniform_real_distribution<float> depth(-50.f, -1.f);
+	std::vector<float> x(vertexCount), y(vertexCount), z(vertexCount);
+	for (int i = 0; i < vertexCount; ++i)
+	{
+		x[i] = side(random);
+		y[i] = side(random);
+		z[i] = depth(random);
+	}
+
+	ScreenPoint screenSize(width, height);
+	Matrix4x4 viewProjection = CreateViewProjection((float)width / height);
+	std::vector<float> screenX(vertexCount), screenY(vertexCount), screenZ(vertexCount);
+	std::vector<Vector3> reference(vertexCount);
+
+	double scalarMilliSeconds = BenchmarkUtil::MeasureMilliSeconds(iterations, [&]() {
+		for (int i = 0; i < vertexCount; ++i)
+		{
+			Vector4 clip = viewProjection * Vector4(x[i], y[i], z[i], 1.f);
+			float invW = 1.f / clip.W;
+			reference[i] = Vector3(clip.X * invW * width * 0.5f + width * 0.5f, -clip.Y * invW * height * 0.5f + height * 0.5f, clip.Z * invW);
+		}
+	});
+
+	double batchMilliSeconds = BenchmarkUtil::MeasureMilliSeconds(iterations, [&]() {
+		VertexTransform::ProjectToScreen(viewProjection, screenSize, x.data(), y.data(), z.data(), screenX.data(), screenY.data(), screenZ.data(), vertexCount);
+	});
+
+	float maxError = 0.f;
+	int pixelMismatches = 0;
+	for (int i = 0; i < vertexCount; ++i)
+	{
+		maxError = Math::Max(maxError, Math::Abs(screenX[i] - reference[i].X));
+		maxError = Math::Max(maxError, Math::Abs(screenY[i] - reference[i].Y));
+		ScreenPoint pixel(screenX[i], screenY[i]);
+		ScreenPoint referencePixel(reference[i].X, reference[i].Y);
+		if (pixel.X != referencePixel.X || pixel.Y != referencePixel.Y)
+		{
+			pixelMismatches++;
+		}
+	}
+
+	std::printf("%d vertices, %d iterations, %dx%d\n", vertexCount, iterations, width, height);
+	std::printf("%10s %10s %12s\n", "path", "ms/frame", "Mvertex/s");
+	std::printf("%10s %10.3f %12.1f\n", "scalar", scalarMilliSeconds, vertexCount / scalarMilliSeconds * 1e-3);
+	std::printf("%10s %10.3f %12.1f\n", "batch", batchMilliSeconds, vertexCount / batchMilliSeconds * 1e-3);
+	std::printf("max error %.6f px, pixel mismatches %d\n", maxError, pixelMismatches);
+	return maxError <= MaxError ? 0 : 1;
+}
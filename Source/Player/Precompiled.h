@@ -5,10 +5,19 @@
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #include <tchar.h>
+#include <timeapi.h>
 #include "Res/resource.h"
 
+#else
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
 #endif
 
+#include <memory>
+
 #include "MathHeaders.h"
 #include "EngineHeaders.h"
 #include "RendererHeaders.h"
@@ -0,0 +1,150 @@
+#include "Precompiled.h"
+#include "SoftRenderer.h"
+#include "GenericUtil.h"
+
+// Usage : SoftRendererPlayer [Width] [Height] [FrameCount] [DumpPath.ppm] [--fastclear] [--tiled[=Workers]] [--profile[=Trace.json]] [--fps=Rate] [--buffers=Count]
+// With --profile the zone statistics are printed at the end and the trace is written when a path is given.
+// With --fps frames are paced to the given rate and the deadlines they missed are printed.
+// With --buffers frames are presented on their own thread from a swap chain of that many buffers.
+int main(int argc, char* argv[])
+{
+	ScreenPoint defScreenSize(800, 600);
+	int frameCount = 1000;
+	std::string dumpPath;
+	bool fastClear = false;
+	bool profile = false;
+	std::string tracePath;
+	float targetFrameRate = 0.f;
+	RenderingSettings settings;
+	bool isValid = true;
+
+	std::vector<std::string> arguments;
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument(argv[i]);
+		if (argument == "--fastclear")
+		{
+			fastClear = true;
+		}
+		else if (argument.compare(0, 9, "--profile") == 0)
+		{
+			profile = true;
+			if (argument.size() > 10 && argument[9] == '=')
+			{
+				tracePath = argument.substr(10);
+			}
+		}
+		else if (argument.compare(0, 10, "--buffers=") == 0)
+		{
+			isValid &= GenericUtil::ParseUInt(argument.c_str() + 10, 1, SwapChain::MaxBufferCount, settings.BufferCount);
+		}
+		else if (argument.compare(0, 6, "--fps=") == 0)
+		{
+			targetFrameRate = (float)std::atof(argument.c_str() + 6);
+		}
+		else if (argument.compare(0, 7, "--tiled") == 0)
+		{
+			settings.Rasterizer = RasterizerMode::TileBinned;
+			if (argument.size() > 7)
+			{
+				isValid &= argument[7] == '=' && GenericUtil::ParseUInt(argument.c_str() + 8, 0, WorkerPool::MaxWorkerCount, settings.WorkerCount);
+			}
+		}
+		else
+		{
+			arguments.emplace_back(argument);
+		}
+	}
+
+	if (arguments.size() > 1)
+	{
+		defScreenSize = ScreenPoint(std::atoi(arguments[0].c_str()), std::atoi(arguments[1].c_str()));
+	}
+
+	if (arguments.size() > 2)
+	{
+		frameCount = std::atoi(arguments[2].c_str());
+	}
+
+	if (arguments.size() > 3)
+	{
+		dumpPath = arguments[3];
+	}
+
+	if (!isValid || defScreenSize.HasZero() || frameCount <= 0 || targetFrameRate < 0.f)
+	{
+		std::fprintf(stderr, "Invalid arguments.\n");
+		return -1;
+	}
+
+	HeadlessRSI* rsi = new HeadlessRSI();
+	SoftRenderer instance(rsi);
+	instance.PerformanceInitFunc = GenericUtil::GetCyclesPerMilliSeconds;
+	instance.PerformanceMeasureFunc = GenericUtil::GetCurrentTimeStamp;
+	GenericUtil::BindInput(instance.GetGameEngine().GetInputManager());
+	instance.SetRenderingSettings(settings);
+
+	FrameSchedulerSettings schedulerSettings;
+	schedulerSettings.TargetFrameRate = targetFrameRate;
+	instance.GetFrameScheduler().SetSettings(schedulerSettings);
+	rsi->SetFastClear(fastClear);
+
+	// The first tick only initializes the renderer and the engine.
+	instance.OnResize(defScreenSize);
+	instance.OnTick();
+	if (!rsi->IsInitialized())
+	{
+		std::fprintf(stderr, "Renderer initialization failed!\n");
+		return -1;
+	}
+
+	Profiler::SetThreadName("Main");
+	Profiler::SetEnabled(profile);
+	for (int frame = 0; frame < frameCount; ++frame)
+	{
+		if (!dumpPath.empty() && frame == frameCount - 1)
+		{
+			rsi->RequestFrameDump(dumpPath);
+		}
+
+		instance.OnTick();
+	}
+
+	std::printf("%d frames at %dx%d : %.3f ms, %.2f fps, %.3f ms per frame before pacing, %.2f MB presented\n",
+		frameCount, defScreenSize.X, defScreenSize.Y, instance.GetElapsedTime(), instance.GetAverageFPS(),
+		instance.GetAverageFrameTime(), rsi->GetTotalPresentedBytes() / (1024.f * 1024.f));
+
+	UINT32 bufferCount = rsi->GetRenderingSettings().BufferCount;
+	if (bufferCount > 1)
+	{
+		SwapChainStatistics swapChain = rsi->GetSwapChainStatistics();
+		std::printf("%u buffers : present latency %.3f ms avg, %.3f ms max, queue depth %.2f avg, %u max, %.3f ms stalled\n",
+			bufferCount, swapChain.AverageLatencyMilliSeconds, swapChain.MaxLatencyMilliSeconds,
+			swapChain.AverageQueueDepth, swapChain.MaxQueueDepth, swapChain.StallMilliSeconds);
+	}
+
+	const FrameScheduler& scheduler = instance.GetFrameScheduler();
+	if (targetFrameRate > 0.f)
+	{
+		std::printf("paced to %.2f fps : %llu missed deadlines, %llu simulation steps, %llu dropped\n", targetFrameRate,
+			(unsigned long long)scheduler.GetMissedDeadlineCount(), (unsigned long long)scheduler.GetStepCount(), (unsigned long long)scheduler.GetDroppedStepCount());
+	}
+
+	if (profile)
+	{
+		Profiler::SetEnabled(false);
+		ProfileCapture capture = Profiler::Capture();
+		for (const std::string& text : capture.GetSummaryTexts())
+		{
+			std::printf("%s\n", text.c_str());
+		}
+
+		if (!tracePath.empty() && !capture.WriteChromeTrace(tracePath))
+		{
+			std::fprintf(stderr, "Failed to write %s\n", tracePath.c_str());
+		}
+	}
+
+	instance.OnShutdown();
+	return 0;
+}
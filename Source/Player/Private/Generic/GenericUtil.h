@@ -0,0 +1,51 @@
+#pragma once
+
+namespace GenericUtil
+{
+	float GetCyclesPerMilliSeconds()
+	{
+		using namespace std::chrono;
+		return (float)duration_cast<steady_clock::duration>(milliseconds(1)).count();
+	}
+
+	long long GetCurrentTimeStamp()
+	{
+		return std::chrono::steady_clock::now().time_since_epoch().count();
+	}
+
+	// Reads a whole decimal number in [InMinimum, InMaximum].
+	bool ParseUInt(const char* InText, UINT32 InMinimum, UINT32 InMaximum, UINT32& OutValue)
+	{
+		char* end = nullptr;
+		long long value = std::strtoll(InText, &end, 10);
+		if (end == InText || *end != '\0' || value < (long long)InMinimum || value > (long long)InMaximum)
+		{
+			return false;
+		}
+
+		OutValue = (UINT32)value;
+		return true;
+	}
+
+	float GetXAxisInput()
+	{
+		return 0.f;
+	}
+
+	float GetYAxisInput()
+	{
+		return 0.f;
+	}
+
+	bool SpacePressedInput()
+	{
+		return false;
+	}
+
+	void BindInput(InputManager& InInputManager)
+	{
+		InInputManager.GetXAxis = GenericUtil::GetXAxisInput;
+		InInputManager.GetYAxis = GenericUtil::GetYAxisInput;
+		InInputManager.SpacePressed = GenericUtil::SpacePressedInput;
+	}
+}
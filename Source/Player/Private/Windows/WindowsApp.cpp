@@ -4,10 +4,46 @@
 #include "WindowsUtil.h"
 #include "WindowsPlayer.h"
 
+namespace
+{
+	// ٿ ɼ ڿ   ġ. ɼ  nullptr
+	const TCHAR* FindOptionValue(LPCTSTR InCmdLine, LPCTSTR InOption)
+	{
+		const TCHAR* option = (InCmdLine != nullptr) ? _tcsstr(InCmdLine, InOption) : nullptr;
+		return (option != nullptr) ? option + _tcslen(InOption) : nullptr;
+	}
+
+	// ª Ⱑ ϵ Ÿ̸ ػ󵵸 1ms ϰ, ߰ ȯϴ    ǵ
+	class TimerResolutionScope
+	{
+	public:
+		explicit TimerResolutionScope(bool InEnabled) : _Enabled(InEnabled && timeBeginPeriod(1) == TIMERR_NOERROR) { }
+		~TimerResolutionScope()
+		{
+			if (_Enabled)
+			{
+				timeEndPeriod(1);
+			}
+		}
+
+		TimerResolutionScope(const TimerResolutionScope&) = delete;
+		TimerResolutionScope& operator=(const TimerResolutionScope&) = delete;
+
+	private:
+		bool _Enabled;
+	};
+}
+
 int APIENTRY _tWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPTSTR lpCmdLine, int nCmdShow)
 {
 	ScreenPoint defScreenSize(800, 600);
 	SoftRenderer instance(new WindowsRSI());
+
+	// --profile :    踦  ¿  ũ Ʈ̽  
+	bool profile = (lpCmdLine != nullptr) && (_tcsstr(lpCmdLine, _T("--profile")) != nullptr);
+	Profiler::SetThreadName("Main");
+	Profiler::SetEnabled(profile);
+
 	WindowsPlayer::gOnResizeFunc = [&instance](const ScreenPoint& InNewScreenSize) { 
 		if (InNewScreenSize.HasZero()) {
 			return;
@@ -18,6 +54,23 @@ int APIENTRY _tWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPTSTR lpCm
 	instance.PerformanceMeasureFunc = WindowsUtil::GetCurrentTimeStamp;
 	WindowsUtil::BindInput(instance.GetGameEngine().GetInputManager());
 
+	// --fps=ǥ  Ʈ :   Ʈ   ̸ 
+	FrameSchedulerSettings schedulerSettings;
+	if (const TCHAR* fpsValue = FindOptionValue(lpCmdLine, _T("--fps=")))
+	{
+		schedulerSettings.TargetFrameRate = Math::Max((float)_tstof(fpsValue), 0.f);
+	}
+	instance.GetFrameScheduler().SetSettings(schedulerSettings);
+	TimerResolutionScope timerResolution(schedulerSettings.TargetFrameRate > 0.f);
+
+	// --buffers=  : 2 ̸̻ ȭ   尡 ð ׵   ׸
+	RenderingSettings renderingSettings;
+	if (const TCHAR* buffersValue = FindOptionValue(lpCmdLine, _T("--buffers=")))
+	{
+		renderingSettings.BufferCount = (UINT32)Math::Max(_ttoi(buffersValue), 1);
+	}
+	instance.SetRenderingSettings(renderingSettings);
+
 	if (!WindowsPlayer::Create(hInstance, defScreenSize))
 	{
 		return -1;
@@ -41,6 +94,17 @@ int APIENTRY _tWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPTSTR lpCm
 		}
 	}
 
+	if (profile)
+	{
+		Profiler::SetEnabled(false);
+		ProfileCapture capture = Profiler::Capture();
+		for (const std::string& text : capture.GetSummaryTexts())
+		{
+			OutputDebugStringA((text + "\n").c_str());
+		}
+		capture.WriteChromeTrace("SoftRendererProfile.json");
+	}
+
 	instance.OnShutdown();
 	WindowsPlayer::Destroy();
 	return 0;
@@ -28,7 +28,7 @@ void SoftRenderer::OnTick()
 		}
 
 		// Ʈ  ʱȭ.
-		if (!_RSI->Init(_ScreenSize))
+		if (!_RSI->Init(_ScreenSize, _RenderingSettings))
 		{
 			return;
 		}
@@ -47,12 +47,17 @@ void SoftRenderer::OnTick()
 		if (_AllInitialized)
 		{
 			BindTickFunctions();
+
+			// ٷ  ս īͷ ð .
+			_FrameScheduler.SetTimeSource(PerformanceMeasureFunc, _CyclesPerMilliSeconds);
+			_FrameScheduler.Reset();
 		}
 	}
 	else
 	{
 		assert(_RSI != nullptr && _RSI->IsInitialized() && !_ScreenSize.HasZero());
 
+		PROFILE_SCOPE("Frame");
 		PreUpdate();
 		Update();
 		PostUpdate();
@@ -66,7 +71,7 @@ void SoftRenderer::OnResize(const ScreenPoint& InNewScreenSize)
 	// ũⰡ Ǹ   ʱȭ
 	if (_RendererInitialized)
 	{
-		_RSI->Init(InNewScreenSize);
+		_RSI->Init(InNewScreenSize, _RenderingSettings);
 	}
 
 	if (_GameEngineInitialized)
@@ -83,6 +88,8 @@ void SoftRenderer::OnShutdown()
 
 void SoftRenderer::PreUpdate()
 {
+	PROFILE_SCOPE("PreUpdate");
+
 	//   .
 	_FrameTimeStamp = PerformanceMeasureFunc();
 	if (_FrameCount == 0)
@@ -100,39 +107,60 @@ void SoftRenderer::PostUpdate()
 	RenderFrame();
 
 	//  .
-	_RSI->EndFrame();
+	{
+		PROFILE_SCOPE("EndFrame");
+		_RSI->EndFrame();
+	}
 
-	//   .
+	//  ó ð .  ð  .
 	_FrameCount++;
+	INT64 workEndTimeStamp = PerformanceMeasureFunc();
+	_FrameTime = (workEndTimeStamp - _FrameTimeStamp) / _CyclesPerMilliSeconds;
+	_TotalFrameTime += _FrameTime;
+	_FrameFPS = _FrameTime == 0.f ? 0.f : 1000.f / _FrameTime;
+
+	// ǥ  Ʈ   ӱ .
+	{
+		PROFILE_SCOPE("FrameWait");
+		_FrameScheduler.WaitForNextFrame();
+	}
+
+	// ⸦   ݰ  FPS .
 	INT64 currentTimeStamp = PerformanceMeasureFunc();
-	INT64 frameCycles = currentTimeStamp - _FrameTimeStamp;
 	INT64 elapsedCycles = currentTimeStamp - _StartTimeStamp;
-	_FrameTime = frameCycles / _CyclesPerMilliSeconds;
+	_PacedFrameTime = (currentTimeStamp - _FrameTimeStamp) / _CyclesPerMilliSeconds;
 	_ElapsedTime = elapsedCycles / _CyclesPerMilliSeconds;
-	_FrameFPS = _FrameTime == 0.f ? 0.f : 1000.f / _FrameTime;
 	_AverageFPS = _ElapsedTime == 0.f ? 0.f : 1000.f / _ElapsedTime * _FrameCount;
 }
 
 void SoftRenderer::RenderFrame()
 {
+	PROFILE_SCOPE("RenderFrame");
 	if (_TickFunctionBound)
 	{
-		RenderFrameFunc();
+		RenderFrameFunc(_FrameScheduler.GetInterpolationAlpha());
 	}
 }
 
 void SoftRenderer::Update()
 {
+	PROFILE_SCOPE("Update");
+
+	//    帥 ðŭ     .
+	int stepCount = _FrameScheduler.BeginFrame();
 	if (_TickFunctionBound)
 	{
-		UpdateFunc(_FrameTime / 1000.f);
+		for (int step = 0; step < stepCount; ++step)
+		{
+			UpdateFunc(_FrameScheduler.GetFixedStepSeconds());
+		}
 	}
 }
 
 void SoftRenderer::BindTickFunctions()
 {
 	using namespace std::placeholders;
-	RenderFrameFunc = std::bind(&SoftRenderer::Render2D, this);
+	RenderFrameFunc = std::bind(&SoftRenderer::Render2D, this, _1);
 	UpdateFunc = std::bind(&SoftRenderer::Update2D, this, _1);
 	_TickFunctionBound = true;
 }
@@ -15,21 +15,33 @@ public:
 public:
 	// α׷ ⺻ 
 	const ScreenPoint& GetScreenSize() { return _ScreenSize; }
+	//  ó ð  ð   ִ FPS. ǥ  Ʈ ߴ  ð 
+	float GetFrameTime() const { return _FrameTime; }
+	float GetAverageFrameTime() const { return _FrameCount == 0 ? 0.f : _TotalFrameTime / _FrameCount; }
 	float GetFrameFPS() const { return _FrameFPS; }
+	//  ð    ݰ  FPS
+	float GetPacedFrameTime() const { return _PacedFrameTime; }
+	float GetAverageFPS() const { return _AverageFPS; }
 	float GetElapsedTime() const { return _ElapsedTime; }
 
+	//  ʱȭ ɼ. ʱȭ  ؾ 
+	void SetRenderingSettings(const RenderingSettings& InSettings) { _RenderingSettings = InSettings; }
+
 public:
 	//    Լ
 	std::function<float()> PerformanceInitFunc;
 	std::function<INT64()> PerformanceMeasureFunc;
 
 	// ƽ ó  Լ
-	std::function<void()> RenderFrameFunc;
+	std::function<void(float InterpolationAlpha)> RenderFrameFunc;
 	std::function<void(float DeltaSeconds)> UpdateFunc;
 
 	//   ۷
 	DD::GameEngine& GetGameEngine() { return _GameEngine; }
 
+	//  ð ݰ ǥ  Ʈ ϴ ٷ
+	FrameScheduler& GetFrameScheduler() { return _FrameScheduler; }
+
 private:
 	// ⺻  Լ
 	void PreUpdate();
@@ -44,15 +56,26 @@ private:
 private:
 	// 2D  Լ
 	void Update2D(float InDeltaSeconds);
-	void Render2D();
+	void Render2D(float InInterpolationAlpha);
 	void DrawGrid2D();
 
 	int _Grid2DUnit = 10;
 
-	//     
+	//     .   
 	Vector2 _CurrentPosition = Vector2::Zero;
 	LinearColor _CurrentColor = LinearColor::Blue;
 
+	//     Ѱִ 
+	struct GameState2D
+	{
+		Vector2 PreviousPosition;
+		Vector2 CurrentPosition;
+		LinearColor CurrentColor;
+	};
+
+	//    ۷  ¸ Ƿ   ٸ 忡 ص 
+	SnapshotBuffer<GameState2D> _GameState2D{ GameState2D{ Vector2::Zero, Vector2::Zero, LinearColor::Blue } };
+
 private:
 	// ʱȭ  
 	bool _PerformanceCheckInitialized = false;
@@ -70,13 +93,19 @@ private:
 	long _FrameCount = 0;
 	float _CyclesPerMilliSeconds = 0.f;
 	float _FrameTime = 0.f;
+	float _TotalFrameTime = 0.f;
+	float _PacedFrameTime = 0.f;
 	float _ElapsedTime = 0.f;
 	float _AverageFPS = 0.f;
 	float _FrameFPS = 0.f;
 
 	//  ̽
 	std::unique_ptr<RenderingSoftwareInterface> _RSI;
+	RenderingSettings _RenderingSettings;
 
 	//  
 	DD::GameEngine _GameEngine;
+
+	//  ٷ
+	FrameScheduler _FrameScheduler;
 };
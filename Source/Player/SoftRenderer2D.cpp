@@ -5,6 +5,13 @@
 // ׸ ׸
 void SoftRenderer::DrawGrid2D()
 {
+	// ȭ ũ ׸   ĳõ  ̾ 
+	UINT64 layerKey = ((UINT64)_ScreenSize.X << 48) | ((UINT64)_ScreenSize.Y << 32) | (UINT32)_Grid2DUnit;
+	if (!_RSI->BeginBackgroundLayer(layerKey))
+	{
+		return;
+	}
+
 	// ׸ 
 	LinearColor gridColor(LinearColor(0.8f, 0.8f, 0.8f, 0.3f));
 
@@ -32,6 +39,8 @@ void SoftRenderer::DrawGrid2D()
 	//   ׸
 	_RSI->DrawFullHorizontalLine(screenHalfSize.Y, LinearColor::Red);
 	_RSI->DrawFullVerticalLine(screenHalfSize.X, LinearColor::Green);
+
+	_RSI->EndBackgroundLayer();
 }
 
 
@@ -44,25 +53,42 @@ void SoftRenderer::Update2D(float InDeltaSeconds)
 	//  ⿡ Է  
 	InputManager input = _GameEngine.GetInputManager();
 	Vector2 deltaPosition = Vector2(input.GetXAxis(), input.GetYAxis()) * moveSpeed * InDeltaSeconds;
+	Vector2 previousPosition = _CurrentPosition;
 	_CurrentPosition += deltaPosition;
 
 	_CurrentColor = input.SpacePressed() ? LinearColor::Red : LinearColor::Blue;
+
+	//   Ѱ ¸  ä  
+	GameState2D& state = _GameState2D.GetWriteState();
+	state.PreviousPosition = previousPosition;
+	state.CurrentPosition = _CurrentPosition;
+	state.CurrentColor = _CurrentColor;
+	_GameState2D.Publish();
 }
 
 //  
-void SoftRenderer::Render2D()
+void SoftRenderer::Render2D(float InInterpolationAlpha)
 {
 	//  ׸
 	DrawGrid2D();
 
+	//    Ѱ 
+	const GameState2D& state = _GameState2D.AcquireLatest();
+
+	//     ̸  ġ
+	Vector2 position = state.PreviousPosition * (1.f - InInterpolationAlpha) + state.CurrentPosition * InInterpolationAlpha;
+
 	//    ¿  
-	_RSI->DrawPoint(_CurrentPosition, _CurrentColor);
-	_RSI->DrawPoint(_CurrentPosition + Vector2::UnitX, _CurrentColor);
-	_RSI->DrawPoint(_CurrentPosition - Vector2::UnitX, _CurrentColor);
-	_RSI->DrawPoint(_CurrentPosition + Vector2::UnitY, _CurrentColor);
-	_RSI->DrawPoint(_CurrentPosition - Vector2::UnitY, _CurrentColor);
+	Vector2 points[] = {
+		position,
+		position + Vector2::UnitX,
+		position - Vector2::UnitX,
+		position + Vector2::UnitY,
+		position - Vector2::UnitY
+	};
+	_RSI->DrawPoints(points, 5, state.CurrentColor);
 
 	//  ġ ȭ鿡 
-	_RSI->PushStatisticText(_CurrentPosition.ToString());
+	_RSI->PushStatisticText(position.ToString());
 }
 
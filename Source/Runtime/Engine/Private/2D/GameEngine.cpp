@@ -10,5 +10,12 @@ bool GameEngine::Init(const ScreenPoint& InViewportSize)
 	}
 
 	_ViewportSize = InViewportSize;
+
+	// Workers are kept across resizes, and only started once a job is scheduled.
+	if (!_JobSystem.IsStarted() && !_JobSystem.IsStartPending())
+	{
+		_JobSystem.StartOnFirstUse(JobSystem::GetDefaultWorkerCount());
+	}
+
 	return true;
 }
@@ -0,0 +1,96 @@
+#include "Precompiled.h"
+
+namespace
+{
+	// Weight of the newest sample in the sleep statistics.
+	const double SleepSampleWeight = 0.1;
+}
+
+void FrameScheduler::SetTimeSource(const TimeStampFunction& InTimeStampFunction, float InCyclesPerMilliSeconds)
+{
+	_TimeStampFunction = InTimeStampFunction;
+	_SecondsPerCycle = 1.0 / (InCyclesPerMilliSeconds * 1000.0);
+}
+
+void FrameScheduler::Reset()
+{
+	_PreviousFrameTime = GetTimeStamp();
+	_NextDeadline = _PreviousFrameTime;
+	_Accumulator = 0.0;
+	_FrameCount = 0;
+	_StepCount = 0;
+	_DroppedStepCount = 0;
+	_MissedDeadlineCount = 0;
+	_LastWaitMilliSeconds = 0.f;
+}
+
+int FrameScheduler::BeginFrame()
+{
+	INT64 now = GetTimeStamp();
+	_Accumulator += ToSeconds(now - _PreviousFrameTime);
+	_PreviousFrameTime = now;
+	_FrameCount++;
+
+	// The remainder is kept even when steps are dropped, so the interpolation stays continuous.
+	double step = _Settings.FixedStepSeconds;
+	int stepCount = (int)(_Accumulator / step);
+	_Accumulator -= stepCount * step;
+	if (stepCount > _Settings.MaxStepsPerFrame)
+	{
+		_DroppedStepCount += stepCount - _Settings.MaxStepsPerFrame;
+		stepCount = _Settings.MaxStepsPerFrame;
+	}
+
+	_StepCount += stepCount;
+	return stepCount;
+}
+
+void FrameScheduler::WaitForNextFrame()
+{
+	if (_Settings.TargetFrameRate <= 0.f)
+	{
+		_LastWaitMilliSeconds = 0.f;
+		return;
+	}
+
+	INT64 now = GetTimeStamp();
+	_NextDeadline += (INT64)(1.0 / (_Settings.TargetFrameRate * _SecondsPerCycle));
+	if (now >= _NextDeadline)
+	{
+		// Start over from here instead of rushing the following frames to catch up.
+		_MissedDeadlineCount++;
+		_NextDeadline = now;
+		_LastWaitMilliSeconds = 0.f;
+		return;
+	}
+
+	SleepUntil(_NextDeadline);
+	_LastWaitMilliSeconds = (float)(ToSeconds(GetTimeStamp() - now) * 1000.0);
+}
+
+void FrameScheduler::SleepUntil(INT64 InDeadline)
+{
+	// Sleep in 1 ms slices while a slice will most likely wake up before the deadline. The estimate
+	// follows the scheduler granularity of the system, which is far coarser than 1 ms on some of them.
+	while (true)
+	{
+		INT64 start = GetTimeStamp();
+		double remaining = ToSeconds(InDeadline - start);
+		if (remaining <= _SleepMean + sqrt(_SleepVariance))
+		{
+			break;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		double slept = ToSeconds(GetTimeStamp() - start);
+		double difference = slept - _SleepMean;
+		_SleepMean += SleepSampleWeight * difference;
+		_SleepVariance = (1.0 - SleepSampleWeight) * (_SleepVariance + SleepSampleWeight * difference * difference);
+	}
+
+	// Spin the rest, giving the core away on every iteration.
+	while (GetTimeStamp() < InDeadline)
+	{
+		std::this_thread::yield();
+	}
+}
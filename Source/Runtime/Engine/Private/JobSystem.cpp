@@ -0,0 +1,292 @@
+#include "Precompiled.h"
+
+namespace
+{
+	// Threads that were not started by a job system use queue 0.
+	struct JobThreadContext
+	{
+		const CK::JobSystem* Owner = nullptr;
+		UINT32 Index = 0;
+	};
+
+	thread_local JobThreadContext CurrentThreadContext;
+
+	const int IdleSpinCount = 64;
+}
+
+JobSystem::~JobSystem()
+{
+	Stop();
+}
+
+void JobSystem::Start(UINT32 InWorkerCount)
+{
+	Stop();
+
+	_Quit = false;
+	for (UINT32 i = 0; i < InWorkerCount + 1; ++i)
+	{
+		_Queues.emplace_back(new WorkQueue());
+	}
+
+	for (UINT32 i = 0; i < InWorkerCount; ++i)
+	{
+		_Workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+	}
+
+	_Started = true;
+}
+
+void JobSystem::StartOnFirstUse(UINT32 InWorkerCount)
+{
+	Stop();
+
+	_PendingWorkerCount = InWorkerCount;
+	_StartPending.store(true, std::memory_order_release);
+}
+
+void JobSystem::Stop()
+{
+	_StartPending.store(false, std::memory_order_relaxed);
+	{
+		std::lock_guard<std::mutex> lock(_SleepMutex);
+		_Quit = true;
+	}
+	_WakeCondition.notify_all();
+
+	for (std::thread& worker : _Workers)
+	{
+		worker.join();
+	}
+
+	_Workers.clear();
+	_Queues.clear();
+	_QueuedJobs = 0;
+	_Started = false;
+}
+
+void JobSystem::Schedule(const JobFunction& InJob, JobCounter* InCounter, JobCounter* InDependency)
+{
+	if (InCounter != nullptr)
+	{
+		InCounter->_Value.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (InDependency != nullptr)
+	{
+		std::lock_guard<std::mutex> lock(InDependency->_Mutex);
+		if (!InDependency->IsDone())
+		{
+			InDependency->_Continuations.push_back({ InJob, InCounter });
+			return;
+		}
+	}
+
+	StartIfPending();
+
+	Job job;
+	job.Task = InJob;
+	job.Counter = InCounter;
+	if (_Queues.empty())
+	{
+		Execute(job);
+		return;
+	}
+
+	Push(std::move(job));
+}
+
+void JobSystem::Wait(JobCounter& InCounter)
+{
+	UINT32 threadIndex = GetCurrentThreadIndex();
+	while (!InCounter.IsDone())
+	{
+		if (_Queues.empty() || !TryRunOne(threadIndex))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::ParallelFor(int InBegin, int InEnd, int InGrainSize, const RangeFunction& InFunction)
+{
+	if (InBegin >= InEnd)
+	{
+		return;
+	}
+
+	StartIfPending();
+
+	int grainSize = InGrainSize;
+	if (grainSize <= 0)
+	{
+		int threadCount = Math::Max((int)GetThreadCount(), 1);
+		grainSize = Math::Max((InEnd - InBegin) / (threadCount * 4), 1);
+	}
+
+	JobCounter counter;
+	SplitRange(InBegin, InEnd, grainSize, InFunction, &counter);
+	Wait(counter);
+}
+
+UINT32 JobSystem::GetDefaultWorkerCount()
+{
+	UINT32 hardwareCount = std::thread::hardware_concurrency();
+	return hardwareCount > 1 ? hardwareCount - 1 : 0;
+}
+
+void JobSystem::StartIfPending()
+{
+	if (_StartPending.load(std::memory_order_acquire))
+	{
+		Start(_PendingWorkerCount);
+	}
+}
+
+void JobSystem::Push(Job&& InJob)
+{
+	WorkQueue& queue = *_Queues[GetCurrentThreadIndex()];
+	{
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+		queue.Jobs.push_back(std::move(InJob));
+	}
+
+	_QueuedJobs.fetch_add(1, std::memory_order_release);
+
+	// Taking the lock orders the push before a worker that is about to sleep checks the queued count.
+	{
+		std::lock_guard<std::mutex> lock(_SleepMutex);
+	}
+	_WakeCondition.notify_one();
+}
+
+bool JobSystem::TryPop(UINT32 InThreadIndex, Job& OutJob)
+{
+	WorkQueue& queue = *_Queues[InThreadIndex];
+	std::lock_guard<std::mutex> lock(queue.Mutex);
+	if (queue.Jobs.empty())
+	{
+		return false;
+	}
+
+	OutJob = std::move(queue.Jobs.back());
+	queue.Jobs.pop_back();
+	_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+	return true;
+}
+
+bool JobSystem::TrySteal(UINT32 InThreadIndex, Job& OutJob)
+{
+	UINT32 queueCount = (UINT32)_Queues.size();
+	for (UINT32 i = 1; i < queueCount; ++i)
+	{
+		WorkQueue& queue = *_Queues[(InThreadIndex + i) % queueCount];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+		if (queue.Jobs.empty())
+		{
+			continue;
+		}
+
+		OutJob = std::move(queue.Jobs.front());
+		queue.Jobs.pop_front();
+		_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	return false;
+}
+
+bool JobSystem::TryRunOne(UINT32 InThreadIndex)
+{
+	Job job;
+	if (!TryPop(InThreadIndex, job) && !TrySteal(InThreadIndex, job))
+	{
+		return false;
+	}
+
+	Execute(job);
+	return true;
+}
+
+void JobSystem::Execute(Job& InJob)
+{
+	InJob.Task();
+	Finish(InJob.Counter);
+}
+
+void JobSystem::Finish(JobCounter* InCounter)
+{
+	if (InCounter == nullptr || InCounter->_Value.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
+
+	// The last job of the counter releases everything that depends on it.
+	std::vector<JobCounter::Continuation> continuations;
+	{
+		std::lock_guard<std::mutex> lock(InCounter->_Mutex);
+		continuations.swap(InCounter->_Continuations);
+	}
+
+	for (JobCounter::Continuation& continuation : continuations)
+	{
+		Job job;
+		job.Task = std::move(continuation.Task);
+		job.Counter = continuation.Counter;
+		if (_Queues.empty())
+		{
+			Execute(job);
+			continue;
+		}
+
+		Push(std::move(job));
+	}
+}
+
+void JobSystem::WorkerLoop(UINT32 InThreadIndex)
+{
+	CurrentThreadContext.Owner = this;
+	CurrentThreadContext.Index = InThreadIndex;
+
+	int idleCount = 0;
+	while (!_Quit.load(std::memory_order_relaxed))
+	{
+		if (TryRunOne(InThreadIndex))
+		{
+			idleCount = 0;
+			continue;
+		}
+
+		if (++idleCount < IdleSpinCount)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(_SleepMutex);
+		_WakeCondition.wait(lock, [this]() { return _Quit.load(std::memory_order_relaxed) || _QueuedJobs.load(std::memory_order_acquire) > 0; });
+		idleCount = 0;
+	}
+}
+
+UINT32 JobSystem::GetCurrentThreadIndex() const
+{
+	return CurrentThreadContext.Owner == this ? CurrentThreadContext.Index : 0;
+}
+
+void JobSystem::SplitRange(int InBegin, int InEnd, int InGrainSize, const RangeFunction& InFunction, JobCounter* InCounter)
+{
+	// The upper half goes to the queue and the lower half is split again on this thread.
+	int end = InEnd;
+	while (end - InBegin > InGrainSize)
+	{
+		int middle = InBegin + (end - InBegin) / 2;
+		int upperEnd = end;
+		Schedule([this, middle, upperEnd, InGrainSize, &InFunction, InCounter]() {
+			SplitRange(middle, upperEnd, InGrainSize, InFunction, InCounter);
+		}, InCounter);
+		end = middle;
+	}
+
+	InFunction(InBegin, end);
+}
@@ -0,0 +1,88 @@
+#include "Precompiled.h"
+
+void TransformHierarchy::Reserve(int InCount)
+{
+	_Parents.reserve(InCount);
+	_Locals.reserve(InCount);
+	_LocalMatrices.reserve(InCount);
+	_WorldMatrices.reserve(InCount);
+	_Flags.reserve(InCount);
+}
+
+void TransformHierarchy::Clear()
+{
+	_Parents.clear();
+	_Locals.clear();
+	_LocalMatrices.clear();
+	_WorldMatrices.clear();
+	_Flags.clear();
+	_FirstDirtyIndex = Math::IntMax;
+	_LastUpdatedCount = 0;
+}
+
+int TransformHierarchy::AddNode(const Transform& InLocal, int InParent)
+{
+	int index = GetNodeCount();
+	assert(InParent == InvalidIndex || (InParent >= 0 && InParent < index));
+
+	_Parents.push_back(InParent);
+	_Locals.push_back(InLocal);
+	_LocalMatrices.push_back(Matrix4x4::Identity);
+	_WorldMatrices.push_back(Matrix4x4::Identity);
+	_Flags.push_back(0);
+	MarkDirty(index);
+	return index;
+}
+
+bool TransformHierarchy::SetParent(int InIndex, int InParent)
+{
+	if (InParent != InvalidIndex && (InParent < 0 || InParent >= InIndex))
+	{
+		return false;
+	}
+
+	_Parents[InIndex] = InParent;
+	MarkDirty(InIndex);
+	return true;
+}
+
+void TransformHierarchy::MarkDirty(int InIndex)
+{
+	_Flags[InIndex] |= LocalDirty;
+	_FirstDirtyIndex = Math::Min(_FirstDirtyIndex, InIndex);
+}
+
+void TransformHierarchy::Update()
+{
+	_LastUpdatedCount = 0;
+	if (!IsDirty())
+	{
+		return;
+	}
+
+	// Every node from the first marked one gets its flags rewritten here, so a parent before that
+	// point did not change and the WorldChanged flag it kept from an earlier update is ignored.
+	int firstIndex = _FirstDirtyIndex;
+	int nodeCount = GetNodeCount();
+	for (int i = firstIndex; i < nodeCount; ++i)
+	{
+		BYTE flags = _Flags[i];
+		int parent = _Parents[i];
+		bool parentChanged = (parent >= firstIndex) && (_Flags[parent] & WorldChanged);
+		if (flags & LocalDirty)
+		{
+			_LocalMatrices[i] = _Locals[i].GetMatrix();
+		}
+		else if (!parentChanged)
+		{
+			_Flags[i] = 0;
+			continue;
+		}
+
+		_WorldMatrices[i] = (parent == InvalidIndex) ? _LocalMatrices[i] : _WorldMatrices[parent] * _LocalMatrices[i];
+		_Flags[i] = WorldChanged;
+		++_LastUpdatedCount;
+	}
+
+	_FirstDirtyIndex = Math::IntMax;
+}
@@ -13,10 +13,14 @@ public:
 public:
 	bool Init(const ScreenPoint& InViewportSize);
 	InputManager& GetInputManager() { return _InputManager; }
+	JobSystem& GetJobSystem() { return _JobSystem; }
+	TransformHierarchy& GetTransformHierarchy() { return _TransformHierarchy; }
 
 private:
 	ScreenPoint _ViewportSize;
 	InputManager _InputManager;
+	JobSystem _JobSystem;
+	TransformHierarchy _TransformHierarchy;
 };
 
 }
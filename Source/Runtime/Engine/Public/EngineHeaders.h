@@ -1,8 +1,19 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 #include "InputManager.h"
+#include "FrameScheduler.h"
+#include "JobSystem.h"
+#include "SnapshotBuffer.h"
+#include "TransformHierarchy.h"
 #include "2D/GameEngine.h"
 
 using namespace CK;
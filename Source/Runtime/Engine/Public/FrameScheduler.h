@@ -0,0 +1,83 @@
+#pragma once
+
+namespace CK
+{
+
+struct FrameSchedulerSettings
+{
+	// Length of one simulation step.
+	float FixedStepSeconds = 1.f / 60.f;
+	// Steps run at most in one frame. Time beyond that is dropped so that a slow frame cannot snowball.
+	int MaxStepsPerFrame = 5;
+	// Frames per second to pace to. Zero runs frames back to back.
+	float TargetFrameRate = 0.f;
+};
+
+// Fixed timestep loop with frame pacing. BeginFrame turns the time since the previous frame into
+// a number of fixed simulation steps and keeps the remainder, which render can use to blend between
+// the last two simulation states. WaitForNextFrame sleeps until shortly before the next deadline and
+// spins the rest, so a paced loop neither burns a core nor overshoots by a whole sleep quantum.
+// Time comes from a time stamp function, the steady clock unless the application sets its own.
+class FrameScheduler
+{
+public:
+	typedef std::function<INT64()> TimeStampFunction;
+
+public:
+	FrameScheduler() = default;
+	explicit FrameScheduler(const FrameSchedulerSettings& InSettings) : _Settings(InSettings) { }
+
+public:
+	const FrameSchedulerSettings& GetSettings() const { return _Settings; }
+	void SetSettings(const FrameSchedulerSettings& InSettings) { _Settings = InSettings; }
+
+	// The function returns time stamps that advance InCyclesPerMilliSeconds per millisecond. Call Reset afterwards.
+	void SetTimeSource(const TimeStampFunction& InTimeStampFunction, float InCyclesPerMilliSeconds);
+
+	// Restarts timing from now and clears the counters.
+	void Reset();
+
+	// Returns the number of fixed steps to run this frame.
+	int BeginFrame();
+	float GetFixedStepSeconds() const { return _Settings.FixedStepSeconds; }
+	// Fraction of a step left over after this frame's steps, in [0, 1).
+	float GetInterpolationAlpha() const { return (float)(_Accumulator / _Settings.FixedStepSeconds); }
+
+	// Returns at once without a target frame rate.
+	void WaitForNextFrame();
+
+	UINT64 GetFrameCount() const { return _FrameCount; }
+	UINT64 GetStepCount() const { return _StepCount; }
+	// Steps skipped because a frame needed more than MaxStepsPerFrame.
+	UINT64 GetDroppedStepCount() const { return _DroppedStepCount; }
+	// Frames that were already past their deadline when they finished.
+	UINT64 GetMissedDeadlineCount() const { return _MissedDeadlineCount; }
+	float GetLastWaitMilliSeconds() const { return _LastWaitMilliSeconds; }
+
+private:
+	INT64 GetTimeStamp() const { return _TimeStampFunction(); }
+	double ToSeconds(INT64 InCycles) const { return InCycles * _SecondsPerCycle; }
+	void SleepUntil(INT64 InDeadline);
+
+private:
+	FrameSchedulerSettings _Settings;
+
+	TimeStampFunction _TimeStampFunction = []() { return (INT64)std::chrono::steady_clock::now().time_since_epoch().count(); };
+	double _SecondsPerCycle = (double)std::chrono::steady_clock::period::num / std::chrono::steady_clock::period::den;
+
+	INT64 _PreviousFrameTime = 0;
+	INT64 _NextDeadline = 0;
+	double _Accumulator = 0.0;
+
+	// Running mean and variance of how long a 1 ms sleep actually takes.
+	double _SleepMean = 0.002;
+	double _SleepVariance = 0.0;
+
+	UINT64 _FrameCount = 0;
+	UINT64 _StepCount = 0;
+	UINT64 _DroppedStepCount = 0;
+	UINT64 _MissedDeadlineCount = 0;
+	float _LastWaitMilliSeconds = 0.f;
+};
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+namespace CK
+{
+
+// Counts unfinished jobs. A job scheduled with a dependency starts once that counter drops to zero.
+class JobCounter
+{
+public:
+	JobCounter() = default;
+
+	JobCounter(const JobCounter&) = delete;
+	JobCounter& operator=(const JobCounter&) = delete;
+
+public:
+	bool IsDone() const { return _Value.load(std::memory_order_acquire) == 0; }
+	int GetValue() const { return _Value.load(std::memory_order_acquire); }
+
+private:
+	friend class JobSystem;
+
+	struct Continuation
+	{
+		std::function<void()> Task;
+		JobCounter* Counter;
+	};
+
+	std::atomic<int> _Value{ 0 };
+	std::mutex _Mutex;
+	std::vector<Continuation> _Continuations;
+};
+
+// Work-stealing scheduler. Every thread owns a deque : it pushes and pops new jobs at the back,
+// and idle threads steal the oldest jobs from the front of the others, which are usually the largest.
+// The thread that starts the system takes part as thread 0 whenever it waits on a counter.
+class JobSystem
+{
+public:
+	typedef std::function<void()> JobFunction;
+	typedef std::function<void(int InBegin, int InEnd)> RangeFunction;
+
+public:
+	JobSystem() = default;
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+public:
+	// Zero workers runs every job on the waiting thread.
+	void Start(UINT32 InWorkerCount);
+	// Starts the workers when the first job is scheduled, so a system nothing uses costs no threads.
+	// That first job has to come from the thread that started the system.
+	void StartOnFirstUse(UINT32 InWorkerCount);
+	void Stop();
+	bool IsStarted() const { return _Started; }
+	bool IsStartPending() const { return _StartPending.load(std::memory_order_acquire); }
+	UINT32 GetThreadCount() const { return (UINT32)_Queues.size(); }
+
+	// The counter is increased now and decreased when the job finishes.
+	// With a dependency the job is held back until the dependency counter reaches zero.
+	void Schedule(const JobFunction& InJob, JobCounter* InCounter = nullptr, JobCounter* InDependency = nullptr);
+
+	// Executes other jobs until the counter reaches zero.
+	void Wait(JobCounter& InCounter);
+
+	// Calls InFunction over sub ranges of [InBegin, InEnd) no larger than InGrainSize and returns when all are done.
+	// The range is split in halves so that thieves take big pieces. Zero grain size picks one from the thread count.
+	void ParallelFor(int InBegin, int InEnd, int InGrainSize, const RangeFunction& InFunction);
+
+	static UINT32 GetDefaultWorkerCount();
+
+private:
+	struct Job
+	{
+		JobFunction Task;
+		JobCounter* Counter = nullptr;
+	};
+
+	struct WorkQueue
+	{
+		std::mutex Mutex;
+		std::deque<Job> Jobs;
+	};
+
+	void StartIfPending();
+	void Push(Job&& InJob);
+	bool TryPop(UINT32 InThreadIndex, Job& OutJob);
+	bool TrySteal(UINT32 InThreadIndex, Job& OutJob);
+	bool TryRunOne(UINT32 InThreadIndex);
+	void Execute(Job& InJob);
+	void Finish(JobCounter* InCounter);
+
+	void WorkerLoop(UINT32 InThreadIndex);
+	UINT32 GetCurrentThreadIndex() const;
+
+	void SplitRange(int InBegin, int InEnd, int InGrainSize, const RangeFunction& InFunction, JobCounter* InCounter);
+
+private:
+	std::vector<std::unique_ptr<WorkQueue>> _Queues;
+	std::vector<std::thread> _Workers;
+	std::atomic<int> _QueuedJobs{ 0 };
+	std::atomic<bool> _Quit{ false };
+	bool _Started = false;
+	std::atomic<bool> _StartPending{ false };
+	UINT32 _PendingWorkerCount = 0;
+
+	std::mutex _SleepMutex;
+	std::condition_variable _WakeCondition;
+};
+
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+namespace CK
+{
+
+// Hands the latest complete state from one writer thread to one reader thread without locks.
+// Three slots are allocated up front : the writer fills its own slot and publishes it by swapping it
+// with the shared slot in one atomic exchange, and the reader takes the shared slot the same way when
+// it holds something newer. Neither side ever waits and the reader never sees a half written state,
+// but states published between two reads are skipped.
+// A slot handed back to the writer holds an older state, so every published field has to be written.
+template<typename T>
+class SnapshotBuffer
+{
+public:
+	SnapshotBuffer() = default;
+	explicit SnapshotBuffer(const T& InInitialState) { Reset(InInitialState); }
+
+	SnapshotBuffer(const SnapshotBuffer&) = delete;
+	SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+public:
+	// Not thread safe. Every slot starts from the given state.
+	void Reset(const T& InInitialState);
+
+	// Writer side. The state to fill before the next Publish.
+	T& GetWriteState() { return _Slots[_WriteIndex].State; }
+	void Publish();
+	UINT64 GetPublishedCount() const { return _PublishedCount; }
+
+	// Reader side. Takes the newest published state, or keeps the current one when nothing was published since.
+	const T& AcquireLatest();
+	// The state the last AcquireLatest returned.
+	const T& GetReadState() const { return _Slots[_ReadIndex].State; }
+	// Number of the publish that produced the read state. Zero is the initial state.
+	UINT64 GetReadSequence() const { return _Slots[_ReadIndex].Sequence; }
+
+private:
+	static constexpr BYTE IndexMask = 3;
+	static constexpr BYTE NewFlag = 4;
+
+	// Writer and reader touch different slots, so each one gets its own cache lines.
+	struct alignas(64) Slot
+	{
+		T State;
+		UINT64 Sequence = 0;
+	};
+
+	Slot _Slots[3];
+
+	// Index of the shared slot, with NewFlag set while the reader has not taken it yet.
+	alignas(64) std::atomic<BYTE> _Shared{ 1 };
+
+	alignas(64) BYTE _WriteIndex = 0;
+	UINT64 _PublishedCount = 0;
+
+	alignas(64) BYTE _ReadIndex = 2;
+};
+
+template<typename T>
+void SnapshotBuffer<T>::Reset(const T& InInitialState)
+{
+	for (Slot& slot : _Slots)
+	{
+		slot.State = InInitialState;
+		slot.Sequence = 0;
+	}
+
+	_Shared.store(1, std::memory_order_relaxed);
+	_WriteIndex = 0;
+	_ReadIndex = 2;
+	_PublishedCount = 0;
+}
+
+template<typename T>
+void SnapshotBuffer<T>::Publish()
+{
+	_Slots[_WriteIndex].Sequence = ++_PublishedCount;
+
+	// Release makes the state visible with the index, acquire gets the reader's last writes to the slot handed back.
+	BYTE previous = _Shared.exchange((BYTE)(_WriteIndex | NewFlag), std::memory_order_acq_rel);
+	_WriteIndex = previous & IndexMask;
+}
+
+template<typename T>
+const T& SnapshotBuffer<T>::AcquireLatest()
+{
+	if (_Shared.load(std::memory_order_relaxed) & NewFlag)
+	{
+		BYTE previous = _Shared.exchange(_ReadIndex, std::memory_order_acq_rel);
+		_ReadIndex = previous & IndexMask;
+	}
+
+	return _Slots[_ReadIndex].State;
+}
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+namespace CK
+{
+
+// Flat transform hierarchy. Nodes live in arrays in the order they were added and a parent always
+// comes before its children, so one pass from front to back visits every parent before its subtree.
+// Setters only mark the node : Update rebuilds the local matrices of the marked nodes and the world
+// matrices of them and their descendants, starting from the first marked node.
+class TransformHierarchy
+{
+public:
+	static constexpr int InvalidIndex = -1;
+
+public:
+	TransformHierarchy() = default;
+
+public:
+	void Reserve(int InCount);
+	void Clear();
+
+	// The parent has to exist already. Returns the index of the new node.
+	int AddNode(const Transform& InLocal, int InParent = InvalidIndex);
+	// Only parents that come before the node keep the order valid. Returns false for any other.
+	bool SetParent(int InIndex, int InParent);
+
+	int GetNodeCount() const { return (int)_Parents.size(); }
+	int GetParent(int InIndex) const { return _Parents[InIndex]; }
+
+	const Transform& GetLocalTransform(int InIndex) const { return _Locals[InIndex]; }
+	void SetLocalTransform(int InIndex, const Transform& InLocal) { _Locals[InIndex] = InLocal; MarkDirty(InIndex); }
+	void SetPosition(int InIndex, const Vector3& InPosition) { _Locals[InIndex].Position = InPosition; MarkDirty(InIndex); }
+	void SetRotation(int InIndex, const Quaternion& InRotation) { _Locals[InIndex].Rotation = InRotation; MarkDirty(InIndex); }
+	void SetScale(int InIndex, const Vector3& InScale) { _Locals[InIndex].Scale = InScale; MarkDirty(InIndex); }
+
+	// Cached matrices as of the last Update.
+	const Matrix4x4& GetLocalMatrix(int InIndex) const { return _LocalMatrices[InIndex]; }
+	const Matrix4x4& GetWorldMatrix(int InIndex) const { return _WorldMatrices[InIndex]; }
+
+	bool IsDirty() const { return _FirstDirtyIndex != Math::IntMax; }
+	void Update();
+
+	// World matrices rebuilt by the last Update.
+	int GetLastUpdatedCount() const { return _LastUpdatedCount; }
+
+private:
+	void MarkDirty(int InIndex);
+
+private:
+	enum Flag : BYTE
+	{
+		LocalDirty = 1 << 0,
+		WorldChanged = 1 << 1,
+	};
+
+	std::vector<int> _Parents;
+	std::vector<Transform> _Locals;
+	std::vector<Matrix4x4> _LocalMatrices;
+	std::vector<Matrix4x4> _WorldMatrices;
+	std::vector<BYTE> _Flags;
+
+	int _FirstDirtyIndex = Math::IntMax;
+	int _LastUpdatedCount = 0;
+};
+
+}
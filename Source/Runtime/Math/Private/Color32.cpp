@@ -1,4 +0,0 @@
-
-#include "Precompiled.h"
-
-const Color32 Color32::Error(255, 0, 255, 255);
@@ -0,0 +1,91 @@
+#include "Precompiled.h"
+
+namespace
+{
+	// Thresholds sit right on rounding boundaries, so they are derived in double precision.
+	double SRGBToLinearDouble(double InValue)
+	{
+		if (InValue <= 0.04045)
+		{
+			return InValue / 12.92;
+		}
+
+		return pow((InValue + 0.055) / 1.055, 2.4);
+	}
+}
+
+float ColorSpace::SRGBToLinearExact(float InValue)
+{
+	if (InValue <= 0.04045f)
+	{
+		return InValue / 12.92f;
+	}
+
+	return powf((InValue + 0.055f) / 1.055f, 2.4f);
+}
+
+float ColorSpace::LinearToSRGBExact(float InValue)
+{
+	if (InValue <= 0.0031308f)
+	{
+		return InValue * 12.92f;
+	}
+
+	return 1.055f * powf(InValue, 1.f / 2.4f) - 0.055f;
+}
+
+void ColorSpace::DecodeSRGB(const Color32* InSource, LinearColor* OutDest, int InCount)
+{
+	const float* decode = GetTables().Decode;
+	for (int i = 0; i < InCount; ++i)
+	{
+		const Color32& source = InSource[i];
+		OutDest[i] = LinearColor(decode[source.R], decode[source.G], decode[source.B], source.A * LinearColor::OneOver255);
+	}
+}
+
+void ColorSpace::EncodeSRGB(const LinearColor* InSource, Color32* OutDest, int InCount)
+{
+	const Tables& tables = GetTables();
+	for (int i = 0; i < InCount; ++i)
+	{
+		const LinearColor& source = InSource[i];
+		OutDest[i] = Color32(Encode(tables, source.R), Encode(tables, source.G), Encode(tables, source.B), (BYTE)(Math::Clamp(source.A, 0.f, 1.f) * 255.999f));
+	}
+}
+
+ColorSpace::Tables ColorSpace::BuildTables()
+{
+	Tables tables;
+	tables.Thresholds[0] = 0.f;
+	for (int code = 0; code < 256; ++code)
+	{
+		tables.Decode[code] = SRGBToLinearExact(code / 255.f);
+		if (code > 0)
+		{
+			// Halfway between two codes in sRGB space, rounded up to the next float.
+			double threshold = SRGBToLinearDouble((code - 0.5) / 255.0);
+			float value = (float)threshold;
+			if ((double)value < threshold)
+			{
+				value = nextafterf(value, 1.f);
+			}
+			tables.Thresholds[code] = value;
+		}
+	}
+
+	// A bucket starts from the code of a value slightly below its lower edge, so that rounding
+	// of the bucket index can only leave steps to take forward.
+	int code = 0;
+	for (int bucket = 0; bucket < EncodeBucketCount; ++bucket)
+	{
+		float lowerEdge = (bucket - 0.5f) / (EncodeBucketCount - 1);
+		while (code < 255 && lowerEdge >= tables.Thresholds[code + 1])
+		{
+			code++;
+		}
+		tables.Buckets[bucket] = (BYTE)code;
+	}
+
+	return tables;
+}
@@ -1,16 +0,0 @@
-
-#include "Precompiled.h"
-
-const float LinearColor::OneOver255 = 1.f / 255.f;
-const LinearColor LinearColor::Error(1.f, 0.f, 1.f, 1.f);
-const LinearColor LinearColor::White(1.f, 1.f, 1.f, 1.f);
-const LinearColor LinearColor::Black(0.f, 0.f, 0.f, 1.f);
-const LinearColor LinearColor::Gray(0.5f, 0.5f, 0.5f, 1.f);
-const LinearColor LinearColor::Red(1.f, 0.f, 0.f, 1.f);
-const LinearColor LinearColor::Green(0.f, 1.f, 0.f, 1.f);
-const LinearColor LinearColor::Blue(0.f, 0.f, 1.f, 1.f);
-const LinearColor LinearColor::Yellow(1.f, 1.f, 0.f, 1.f);
-const LinearColor LinearColor::Cyan(0.f, 1.f, 1.f, 1.f);
-const LinearColor LinearColor::Magenta(1.f, 0.f, 1.f, 1.f);
-
-
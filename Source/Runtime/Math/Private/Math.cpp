@@ -1,10 +1,80 @@
 
 #include "Precompiled.h"
 
-const float Math::PI = 3.14159265358979323846f;
-const float Math::TwoPI = 2.f * PI;
-const float Math::HalfPI = 1.57079632679f;
-const float Math::InvPI = 0.31830988618f;
-const int Math::IntMin = (-2147483647 - 1);
-const int Math::IntMax = 2147483647;
+void Math::FastSinCos(const float* InRadians, float* OutSin, float* OutCos, int InCount)
+{
+	int i = 0;
+#if defined(MATH_SIMD_SSE2)
+	for (; i + 4 <= InCount; i += 4)
+	{
+		__m128 sin, cos;
+		FastSinCos(sin, cos, _mm_loadu_ps(InRadians + i));
+		_mm_storeu_ps(OutSin + i, sin);
+		_mm_storeu_ps(OutCos + i, cos);
+	}
+#endif
+	for (; i < InCount; ++i)
+	{
+		FastSinCos(OutSin[i], OutCos[i], InRadians[i]);
+	}
+}
 
+void Math::FastAtan2(const float* InY, const float* InX, float* OutRadians, int InCount)
+{
+	int i = 0;
+#if defined(MATH_SIMD_SSE2)
+	for (; i + 4 <= InCount; i += 4)
+	{
+		_mm_storeu_ps(OutRadians + i, FastAtan2(_mm_loadu_ps(InY + i), _mm_loadu_ps(InX + i)));
+	}
+#endif
+	for (; i < InCount; ++i)
+	{
+		OutRadians[i] = FastAtan2(InY[i], InX[i]);
+	}
+}
+
+void Math::FastInvSqrt(const float* InFloats, float* OutFloats, int InCount)
+{
+	int i = 0;
+#if defined(MATH_SIMD_SSE2)
+	for (; i + 4 <= InCount; i += 4)
+	{
+		_mm_storeu_ps(OutFloats + i, FastInvSqrt(_mm_loadu_ps(InFloats + i)));
+	}
+#endif
+	for (; i < InCount; ++i)
+	{
+		OutFloats[i] = FastInvSqrt(InFloats[i]);
+	}
+}
+
+void Math::FastExp(const float* InFloats, float* OutFloats, int InCount)
+{
+	int i = 0;
+#if defined(MATH_SIMD_SSE2)
+	for (; i + 4 <= InCount; i += 4)
+	{
+		_mm_storeu_ps(OutFloats + i, FastExp(_mm_loadu_ps(InFloats + i)));
+	}
+#endif
+	for (; i < InCount; ++i)
+	{
+		OutFloats[i] = FastExpScalar(InFloats[i]);
+	}
+}
+
+void Math::FastLog(const float* InFloats, float* OutFloats, int InCount)
+{
+	int i = 0;
+#if defined(MATH_SIMD_SSE2)
+	for (; i + 4 <= InCount; i += 4)
+	{
+		_mm_storeu_ps(OutFloats + i, FastLog(_mm_loadu_ps(InFloats + i)));
+	}
+#endif
+	for (; i < InCount; ++i)
+	{
+		OutFloats[i] = FastLogScalar(InFloats[i]);
+	}
+}
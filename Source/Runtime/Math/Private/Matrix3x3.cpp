@@ -1,8 +1,6 @@
 
 #include "Precompiled.h"
 
-const Matrix3x3 Matrix3x3::Identity(Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f));
-
 std::vector<std::string> Matrix3x3::ToStrings() const
 {
 	std::vector<std::string> result;
@@ -1,8 +1,6 @@
 
 #include "Precompiled.h"
 
-const Matrix4x4 Matrix4x4::Identity(Vector4(1.f, 0.f, 0.f, 0.f), Vector4(0.f, 1.f, 0.f, 0.f), Vector4(0.f, 0.f, 1.f, 0.f), Vector4(0.f, 0.f, 0.f, 1.f));
-
 std::vector<std::string> Matrix4x4::ToStrings() const
 {
 	std::vector<std::string> result;
@@ -0,0 +1,9 @@
+
+#include "Precompiled.h"
+
+std::string Quaternion::ToString() const
+{
+	char result[64];
+	std::snprintf(result, sizeof(result), "(%.3f, %.3f, %.3f, %.3f)", X, Y, Z, W);
+	return result;
+}
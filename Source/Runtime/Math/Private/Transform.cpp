@@ -0,0 +1,7 @@
+
+#include "Precompiled.h"
+
+std::string Transform::ToString() const
+{
+	return "P" + Position.ToString() + " R" + Rotation.ToString() + " S" + Scale.ToString();
+}
@@ -1,14 +1,6 @@
 
 #include "Precompiled.h"
 
-const Vector3 Vector3::UnitX(1.f, 0.f, 0.f);
-const Vector3 Vector3::UnitY(0.f, 1.f, 0.f);
-const Vector3 Vector3::UnitZ(0.f, 0.f, 1.f);
-const Vector3 Vector3::Zero(0.f, 0.f, 0.f);
-const Vector3 Vector3::One(1.f, 1.f, 1.f);
-const Vector3 Vector3::Infinity(INFINITY, INFINITY, INFINITY);
-const Vector3 Vector3::InfinityNeg(-INFINITY, -INFINITY, -INFINITY);
-
 std::string Vector3::ToString() const
 {
 	char result[64];
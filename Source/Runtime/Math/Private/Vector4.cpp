@@ -1,15 +1,6 @@
 
 #include "Precompiled.h"
 
-const Vector4 Vector4::UnitX(1.f, 0.f, 0.f, 0.f);
-const Vector4 Vector4::UnitY(0.f, 1.f, 0.f, 0.f);
-const Vector4 Vector4::UnitZ(0.f, 0.f, 1.f, 0.f);
-const Vector4 Vector4::UnitW(0.f, 0.f, 0.f, 1.f);
-const Vector4 Vector4::Zero(0.f, 0.f, 0.f, 0.f);
-const Vector4 Vector4::One(1.f, 1.f, 1.f, 1.f);
-const Vector4 Vector4::Infinity(INFINITY, INFINITY, INFINITY, INFINITY);
-const Vector4 Vector4::InfinityNeg(-INFINITY, -INFINITY, -INFINITY, -INFINITY);
-
 std::string Vector4::ToString() const
 {
 	char result[64];
@@ -0,0 +1,133 @@
+#include "Precompiled.h"
+
+namespace
+{
+	// Row I of the matrix broadcast to every lane.
+	struct MatrixRow
+	{
+		float Values[4];
+	};
+
+	FORCEINLINE MatrixRow GetRow(const Matrix4x4& InMatrix, BYTE InIndex)
+	{
+		return MatrixRow{ { InMatrix[0][InIndex], InMatrix[1][InIndex], InMatrix[2][InIndex], InMatrix[3][InIndex] } };
+	}
+
+	FORCEINLINE float TransformScalar(const MatrixRow& InRow, float InX, float InY, float InZ)
+	{
+		return InRow.Values[0] * InX + InRow.Values[1] * InY + InRow.Values[2] * InZ + InRow.Values[3];
+	}
+
+#if defined(MATH_SIMD_AVX2)
+	FORCEINLINE __m256 TransformAVX(const MatrixRow& InRow, __m256 InX, __m256 InY, __m256 InZ)
+	{
+		__m256 sum = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(InRow.Values[0]), InX), _mm256_mul_ps(_mm256_set1_ps(InRow.Values[1]), InY));
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(InRow.Values[2]), InZ));
+		return _mm256_add_ps(sum, _mm256_set1_ps(InRow.Values[3]));
+	}
+#endif
+
+#if defined(MATH_SIMD_SSE2)
+	FORCEINLINE __m128 TransformSSE(const MatrixRow& InRow, __m128 InX, __m128 InY, __m128 InZ)
+	{
+		__m128 sum = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(InRow.Values[0]), InX), _mm_mul_ps(_mm_set1_ps(InRow.Values[1]), InY));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(InRow.Values[2]), InZ));
+		return _mm_add_ps(sum, _mm_set1_ps(InRow.Values[3]));
+	}
+#endif
+}
+
+void VertexTransform::TransformPoints(const Matrix4x4& InMatrix, const float* InX, const float* InY, const float* InZ,
+	float* OutX, float* OutY, float* OutZ, float* OutW, int InCount)
+{
+	const MatrixRow rowX = GetRow(InMatrix, 0);
+	const MatrixRow rowY = GetRow(InMatrix, 1);
+	const MatrixRow rowZ = GetRow(InMatrix, 2);
+	const MatrixRow rowW = GetRow(InMatrix, 3);
+
+	int i = 0;
+#if defined(MATH_SIMD_AVX2)
+	for (; i + 8 <= InCount; i += 8)
+	{
+		__m256 x = _mm256_loadu_ps(InX + i);
+		__m256 y = _mm256_loadu_ps(InY + i);
+		__m256 z = _mm256_loadu_ps(InZ + i);
+		_mm256_storeu_ps(OutX + i, TransformAVX(rowX, x, y, z));
+		_mm256_storeu_ps(OutY + i, TransformAVX(rowY, x, y, z));
+		_mm256_storeu_ps(OutZ + i, TransformAVX(rowZ, x, y, z));
+		_mm256_storeu_ps(OutW + i, TransformAVX(rowW, x, y, z));
+	}
+#endif
+#if defined(MATH_SIMD_SSE2)
+	for (; i + 4 <= InCount; i += 4)
+	{
+		__m128 x = _mm_loadu_ps(InX + i);
+		__m128 y = _mm_loadu_ps(InY + i);
+		__m128 z = _mm_loadu_ps(InZ + i);
+		_mm_storeu_ps(OutX + i, TransformSSE(rowX, x, y, z));
+		_mm_storeu_ps(OutY + i, TransformSSE(rowY, x, y, z));
+		_mm_storeu_ps(OutZ + i, TransformSSE(rowZ, x, y, z));
+		_mm_storeu_ps(OutW + i, TransformSSE(rowW, x, y, z));
+	}
+#endif
+	for (; i < InCount; ++i)
+	{
+		float x = InX[i], y = InY[i], z = InZ[i];
+		OutX[i] = TransformScalar(rowX, x, y, z);
+		OutY[i] = TransformScalar(rowY, x, y, z);
+		OutZ[i] = TransformScalar(rowZ, x, y, z);
+		OutW[i] = TransformScalar(rowW, x, y, z);
+	}
+}
+
+void VertexTransform::ProjectToScreen(const Matrix4x4& InMatrix, const ScreenPoint& InScreenSize, const float* InX, const float* InY, const float* InZ,
+	float* OutX, float* OutY, float* OutZ, int InCount)
+{
+	// The viewport mapping Pixel = Normalized * HalfSize + HalfSize (Y flipped) is folded into the rows,
+	// so that a single multiply by 1 / W finishes each coordinate.
+	const float halfWidth = InScreenSize.X * 0.5f;
+	const float halfHeight = InScreenSize.Y * 0.5f;
+	const MatrixRow rowW = GetRow(InMatrix, 3);
+	const MatrixRow rowZ = GetRow(InMatrix, 2);
+	MatrixRow rowX = GetRow(InMatrix, 0);
+	MatrixRow rowY = GetRow(InMatrix, 1);
+	for (BYTE c = 0; c < 4; ++c)
+	{
+		rowX.Values[c] = rowX.Values[c] * halfWidth + rowW.Values[c] * halfWidth;
+		rowY.Values[c] = rowY.Values[c] * -halfHeight + rowW.Values[c] * halfHeight;
+	}
+
+	int i = 0;
+#if defined(MATH_SIMD_AVX2)
+	for (; i + 8 <= InCount; i += 8)
+	{
+		__m256 x = _mm256_loadu_ps(InX + i);
+		__m256 y = _mm256_loadu_ps(InY + i);
+		__m256 z = _mm256_loadu_ps(InZ + i);
+		__m256 invW = _mm256_div_ps(_mm256_set1_ps(1.f), TransformAVX(rowW, x, y, z));
+		_mm256_storeu_ps(OutX + i, _mm256_mul_ps(TransformAVX(rowX, x, y, z), invW));
+		_mm256_storeu_ps(OutY + i, _mm256_mul_ps(TransformAVX(rowY, x, y, z), invW));
+		_mm256_storeu_ps(OutZ + i, _mm256_mul_ps(TransformAVX(rowZ, x, y, z), invW));
+	}
+#endif
+#if defined(MATH_SIMD_SSE2)
+	for (; i + 4 <= InCount; i += 4)
+	{
+		__m128 x = _mm_loadu_ps(InX + i);
+		__m128 y = _mm_loadu_ps(InY + i);
+		__m128 z = _mm_loadu_ps(InZ + i);
+		__m128 invW = _mm_div_ps(_mm_set1_ps(1.f), TransformSSE(rowW, x, y, z));
+		_mm_storeu_ps(OutX + i, _mm_mul_ps(TransformSSE(rowX, x, y, z), invW));
+		_mm_storeu_ps(OutY + i, _mm_mul_ps(TransformSSE(rowY, x, y, z), invW));
+		_mm_storeu_ps(OutZ + i, _mm_mul_ps(TransformSSE(rowZ, x, y, z), invW));
+	}
+#endif
+	for (; i < InCount; ++i)
+	{
+		float x = InX[i], y = InY[i], z = InZ[i];
+		float invW = 1.f / TransformScalar(rowW, x, y, z);
+		OutX[i] = TransformScalar(rowX, x, y, z) * invW;
+		OutY[i] = TransformScalar(rowY, x, y, z) * invW;
+		OutZ[i] = TransformScalar(rowZ, x, y, z) * invW;
+	}
+}
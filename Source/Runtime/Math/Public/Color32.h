@@ -6,9 +6,9 @@ namespace CK
 struct Color32
 {
 public:
-	FORCEINLINE Color32() : R(0), G(0), B(0), A(0) { }
-	FORCEINLINE explicit Color32(BYTE InR, BYTE InG, BYTE InB, BYTE InA = 255) : B(InB), G(InG), R(InR), A(InA) { }
-	FORCEINLINE explicit Color32(UINT32 InColor) { GetColorRef() = InColor; }
+	FORCEINLINE constexpr Color32() : B(0), G(0), R(0), A(0) { }
+	FORCEINLINE constexpr explicit Color32(BYTE InR, BYTE InG, BYTE InB, BYTE InA = 255) : B(InB), G(InG), R(InR), A(InA) { }
+	FORCEINLINE constexpr explicit Color32(UINT32 InColor) : B(BYTE(InColor)), G(BYTE(InColor >> 8)), R(BYTE(InColor >> 16)), A(BYTE(InColor >> 24)) { }
 
 	FORCEINLINE const UINT32& GetColorRef() const { return *((UINT32*)this); }
 	FORCEINLINE UINT32& GetColorRef() { return *((UINT32*)this); }
@@ -31,6 +31,8 @@ public:
 	};
 };
 
+inline constexpr Color32 Color32::Error(255, 0, 255, 255);
+
 FORCEINLINE bool Color32::operator==(const Color32& InC) const
 {
 	return GetColorRef() == InC.GetColorRef();
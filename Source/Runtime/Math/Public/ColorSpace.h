@@ -0,0 +1,65 @@
+#pragma once
+
+namespace CK
+{
+
+struct Color32;
+struct LinearColor;
+
+// sRGB transfer functions without transcendental calls per value.
+// Decoding reads a table of the 256 codes. Encoding starts from a bucket table over the linear range
+// and steps over the decision thresholds between neighbouring codes, which gives the correctly
+// rounded code with at most a couple of compares.
+struct ColorSpace
+{
+	static FORCEINLINE float SRGBToLinear(BYTE InValue)
+	{
+		return GetTables().Decode[InValue];
+	}
+
+	static FORCEINLINE BYTE LinearToSRGB(float InValue)
+	{
+		return Encode(GetTables(), InValue);
+	}
+
+	// Reference curves used to build the tables.
+	static float SRGBToLinearExact(float InValue);
+	static float LinearToSRGBExact(float InValue);
+
+	// Row conversions. Alpha is always linear.
+	static void DecodeSRGB(const Color32* InSource, LinearColor* OutDest, int InCount);
+	static void EncodeSRGB(const LinearColor* InSource, Color32* OutDest, int InCount);
+
+	static constexpr int EncodeBucketCount = 4096;
+
+private:
+	struct Tables
+	{
+		float Decode[256];
+		// Smallest linear value that encodes to each code.
+		float Thresholds[256];
+		BYTE Buckets[EncodeBucketCount];
+	};
+
+	static Tables BuildTables();
+
+	// Built on first use rather than by a static initializer, so programs that never convert do not pay for it.
+	static FORCEINLINE const Tables& GetTables()
+	{
+		static const Tables tables = BuildTables();
+		return tables;
+	}
+
+	static FORCEINLINE BYTE Encode(const Tables& InTables, float InValue)
+	{
+		float value = Math::Clamp(InValue, 0.f, 1.f);
+		int code = InTables.Buckets[(int)(value * (EncodeBucketCount - 1))];
+		while (code < 255 && value >= InTables.Thresholds[code + 1])
+		{
+			code++;
+		}
+		return (BYTE)code;
+	}
+};
+
+}
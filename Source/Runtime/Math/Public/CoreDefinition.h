@@ -1,6 +1,7 @@
 #pragma once
 
 typedef unsigned char		BYTE;		// ȣ  8Ʈ
+typedef unsigned short		UINT16;		// ȣ  16Ʈ
 typedef unsigned int		UINT32;		// ȣ  32Ʈ
 typedef unsigned long long	UINT64;		// ȣ  64Ʈ.
 typedef signed long long	INT64;	// ȣ ִ 64Ʈ.
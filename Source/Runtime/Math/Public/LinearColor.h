@@ -6,13 +6,22 @@ namespace CK
 struct LinearColor
 {
 public:
-	FORCEINLINE LinearColor() = default;
-	FORCEINLINE explicit LinearColor(float InR, float InG, float InB, float InA = 1.f) : R(InR), G(InG), B(InB), A(InA) {}
-	FORCEINLINE explicit LinearColor(const Color32& InColor32)
+	FORCEINLINE constexpr LinearColor() = default;
+	FORCEINLINE constexpr explicit LinearColor(float InR, float InG, float InB, float InA = 1.f) : R(InR), G(InG), B(InB), A(InA) {}
+	FORCEINLINE explicit LinearColor(const Color32& InColor32, const bool bSRGB = false)
 	{
-		R = float(InColor32.R) * OneOver255;
-		G = float(InColor32.G) * OneOver255;
-		B = float(InColor32.B) * OneOver255;
+		if (bSRGB)
+		{
+			R = ColorSpace::SRGBToLinear(InColor32.R);
+			G = ColorSpace::SRGBToLinear(InColor32.G);
+			B = ColorSpace::SRGBToLinear(InColor32.B);
+		}
+		else
+		{
+			R = float(InColor32.R) * OneOver255;
+			G = float(InColor32.G) * OneOver255;
+			B = float(InColor32.B) * OneOver255;
+		}
 		A = float(InColor32.A) * OneOver255;
 	}
 
@@ -27,7 +36,7 @@ public:
 
 	FORCEINLINE bool EqualsInRange(const LinearColor& InColor, float InTolerance = KINDA_SMALL_NUMBER) const;
 
-	static const float OneOver255;
+	static constexpr float OneOver255 = 1.f / 255.f;
 	static const LinearColor Error;
 	static const LinearColor White;
 	static const LinearColor Black;
@@ -46,8 +55,29 @@ public:
 	float A = 1.f;
 };
 
+inline constexpr LinearColor LinearColor::Error(1.f, 0.f, 1.f, 1.f);
+inline constexpr LinearColor LinearColor::White(1.f, 1.f, 1.f, 1.f);
+inline constexpr LinearColor LinearColor::Black(0.f, 0.f, 0.f, 1.f);
+inline constexpr LinearColor LinearColor::Gray(0.5f, 0.5f, 0.5f, 1.f);
+inline constexpr LinearColor LinearColor::Red(1.f, 0.f, 0.f, 1.f);
+inline constexpr LinearColor LinearColor::Green(0.f, 1.f, 0.f, 1.f);
+inline constexpr LinearColor LinearColor::Blue(0.f, 0.f, 1.f, 1.f);
+inline constexpr LinearColor LinearColor::Yellow(1.f, 1.f, 0.f, 1.f);
+inline constexpr LinearColor LinearColor::Cyan(0.f, 1.f, 1.f, 1.f);
+inline constexpr LinearColor LinearColor::Magenta(1.f, 0.f, 1.f, 1.f);
+
 FORCEINLINE Color32 LinearColor::ToColor32(const bool bSRGB) const
 {
+	if (bSRGB)
+	{
+		return Color32(
+			ColorSpace::LinearToSRGB(R),
+			ColorSpace::LinearToSRGB(G),
+			ColorSpace::LinearToSRGB(B),
+			(int)(Math::Clamp(A, 0.f, 1.f) * 255.999f)
+		);
+	}
+
 	float FloatR = Math::Clamp(R, 0.f, 1.f);
 	float FloatG = Math::Clamp(G, 0.f, 1.f);
 	float FloatB = Math::Clamp(B, 0.f, 1.f);
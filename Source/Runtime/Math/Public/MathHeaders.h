@@ -1,10 +1,17 @@
 #pragma once
 
 #include <cassert>
+#include <cfloat>
+#include <cstring>
+#include <limits>
 
 #include <math.h>
 
+#if defined(_MSC_VER)
 #include <intrin.h>
+#elif defined(__SSE2__)
+#include <x86intrin.h>
+#endif
 #include "Platform.h"
 
 #include <string>
@@ -18,10 +25,14 @@
 #include "Matrix2x2.h"
 #include "Matrix3x3.h"
 #include "Matrix4x4.h"
+#include "Quaternion.h"
+#include "Transform.h"
 
 #include "ScreenPoint.h"
+#include "VertexTransform.h"
 
 #include "Color32.h"
+#include "ColorSpace.h"
 #include "LinearColor.h"
 
 using namespace CK;
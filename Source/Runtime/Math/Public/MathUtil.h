@@ -5,12 +5,12 @@ namespace CK
 
 struct Math
 {
-	static const float PI;
-	static const float TwoPI;
-	static const float HalfPI;
-	static const float InvPI;
-	static const int IntMin;
-	static const int IntMax;
+	static constexpr float PI = 3.14159265358979323846f;
+	static constexpr float TwoPI = 2.f * PI;
+	static constexpr float HalfPI = 1.57079632679f;
+	static constexpr float InvPI = 0.31830988618f;
+	static constexpr int IntMin = (-2147483647 - 1);
+	static constexpr int IntMax = 2147483647;
 
 	static FORCEINLINE int TruncToInt(float InFloat)
 	{
@@ -118,6 +118,361 @@ struct Math
 
 		return (X - intPortion);
 	}
+
+	static FORCEINLINE float InvSqrt(float InFloat)
+	{
+		return 1.f / sqrtf(InFloat);
+	}
+
+	// Fast tier : polynomial and bit level approximations that callers pick per call site over
+	// the precise versions above and libm. Max errors are measured against double precision libm
+	// by FastMathBenchmark. With SSE every function is a four lane kernel, the scalar version runs
+	// it on one lane and the batch version over arrays, so all of them give the same results.
+
+	// Sine and cosine of radians, reduced to [-PI/4, PI/4] around multiples of PI/2.
+	// Max absolute error 1.2e-7 for |x| <= 1e4.
+	static FORCEINLINE void FastSinCos(float& OutSin, float& OutCos, float InRadian)
+	{
+#if defined(MATH_SIMD_SSE2)
+		__m128 sin, cos;
+		FastSinCos(sin, cos, _mm_set_ss(InRadian));
+		OutSin = _mm_cvtss_f32(sin);
+		OutCos = _mm_cvtss_f32(cos);
+#else
+		int quadrant = FastRoundToInt(InRadian * FastTwoOverPI);
+		float x = FastReduceHalfPI(InRadian, (float)quadrant);
+		float sin = FastSinPolynomial(x);
+		float cos = FastCosPolynomial(x);
+		if (quadrant & 1)
+		{
+			float temp = sin;
+			sin = cos;
+			cos = temp;
+		}
+		OutSin = (quadrant & 2) ? -sin : sin;
+		OutCos = ((quadrant + 1) & 2) ? -cos : cos;
+#endif
+	}
+
+	static FORCEINLINE float FastSin(float InRadian)
+	{
+		float sin, cos;
+		FastSinCos(sin, cos, InRadian);
+		return sin;
+	}
+
+	static FORCEINLINE float FastCos(float InRadian)
+	{
+		float sin, cos;
+		FastSinCos(sin, cos, InRadian);
+		return cos;
+	}
+
+	// Arc tangent of Y / X in [-PI, PI]. Max absolute error 2.1e-7 radians, under one ulp of results near PI.
+	static FORCEINLINE float FastAtan2(float InY, float InX)
+	{
+#if defined(MATH_SIMD_SSE2)
+		return _mm_cvtss_f32(FastAtan2(_mm_set_ss(InY), _mm_set_ss(InX)));
+#else
+		float absX = fabsf(InX);
+		float absY = fabsf(InY);
+		float maxValue = Max(absX, absY);
+		float minValue = Min(absX, absY);
+
+		// Past tan(PI/8) the argument is moved around PI/4 to keep the polynomial short.
+		bool isUpperHalf = minValue > FastTanPIOver8 * maxValue;
+		float numerator = isUpperHalf ? minValue - maxValue : minValue;
+		float denominator = isUpperHalf ? minValue + maxValue : maxValue;
+		float result = FastAtanPolynomial(numerator / Max(denominator, FLT_MIN));
+
+		// The octant adds a multiple of PI/4, whose high part is exact so that only the last add rounds at the result scale.
+		float octant = isUpperHalf ? 1.f : 0.f;
+		if (absY > absX)
+		{
+			octant = 2.f - octant;
+			result = -result;
+		}
+		if (InX < 0.f)
+		{
+			octant = 4.f - octant;
+			result = -result;
+		}
+		result = octant * FastPIOver4High + (result + octant * FastPIOver4Low);
+		return copysignf(result, InY);
+#endif
+	}
+
+	// Estimate refined by one Newton-Raphson step. Max relative error 4.8e-7 for x > 0, 4.8e-6 without SSE.
+	static FORCEINLINE float FastInvSqrt(float InFloat)
+	{
+#if defined(MATH_SIMD_SSE2)
+		return _mm_cvtss_f32(FastInvSqrt(_mm_set_ss(InFloat)));
+#else
+		// Without the estimate instruction the bit level guess needs a second step for a similar error.
+		float estimate = FastAsFloat(0x5f3759dfu - (FastAsUInt(InFloat) >> 1));
+		estimate = estimate * (1.5f - 0.5f * InFloat * estimate * estimate);
+		return estimate * (1.5f - 0.5f * InFloat * estimate * estimate);
+#endif
+	}
+
+	// Batch versions. Output arrays may be the input arrays.
+	static void FastSinCos(const float* InRadians, float* OutSin, float* OutCos, int InCount);
+	static void FastAtan2(const float* InY, const float* InX, float* OutRadians, int InCount);
+	static void FastInvSqrt(const float* InFloats, float* OutFloats, int InCount);
+
+	// Exp and log only come in batches, since expf and logf are faster for one value at a time.
+	// Without SSE they are faster for arrays as well.
+	// e^x, clamped to the normal float range. Max relative error 2.0e-7.
+	static void FastExp(const float* InFloats, float* OutFloats, int InCount);
+	// Natural log for positive normal floats. Max absolute error 1.2e-7 over [1e-30, 1e30].
+	static void FastLog(const float* InFloats, float* OutFloats, int InCount);
+
+#if defined(MATH_SIMD_SSE2)
+	// Four lane kernels.
+	static FORCEINLINE void FastSinCos(__m128& OutSin, __m128& OutCos, __m128 InRadian)
+	{
+		__m128 quadrant = FastRound(_mm_mul_ps(InRadian, _mm_set1_ps(FastTwoOverPI)));
+		__m128 x = _mm_sub_ps(InRadian, _mm_mul_ps(quadrant, _mm_set1_ps(FastHalfPIHigh)));
+		x = _mm_sub_ps(x, _mm_mul_ps(quadrant, _mm_set1_ps(FastHalfPIMid)));
+		x = _mm_sub_ps(x, _mm_mul_ps(quadrant, _mm_set1_ps(FastHalfPILow)));
+
+		__m128 z = _mm_mul_ps(x, x);
+		__m128 sin = FastPolynomial(z, FastPolynomial(z, _mm_set1_ps(FastSin7), FastSin5), FastSin3);
+		sin = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, z), sin));
+		__m128 cos = FastPolynomial(z, FastPolynomial(z, _mm_set1_ps(FastCos8), FastCos6), FastCos4);
+		cos = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_mul_ps(_mm_mul_ps(z, z), cos));
+
+		// Odd quadrants swap sine and cosine, the sign follows bit 1 of the quadrant.
+		__m128i quadrantInt = _mm_cvttps_epi32(quadrant);
+		__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrantInt, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		__m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrantInt, _mm_set1_epi32(2)), 30));
+		__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrantInt, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+		OutSin = _mm_xor_ps(FastSelect(swap, cos, sin), sinSign);
+		OutCos = _mm_xor_ps(FastSelect(swap, sin, cos), cosSign);
+	}
+
+	static FORCEINLINE __m128 FastAtan2(__m128 InY, __m128 InX)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.f);
+		__m128 absX = _mm_andnot_ps(signMask, InX);
+		__m128 absY = _mm_andnot_ps(signMask, InY);
+		__m128 maxValue = _mm_max_ps(absX, absY);
+		__m128 minValue = _mm_min_ps(absX, absY);
+
+		// Past tan(PI/8) the argument is moved around PI/4 to keep the polynomial short.
+		__m128 isUpperHalf = _mm_cmpgt_ps(minValue, _mm_mul_ps(_mm_set1_ps(FastTanPIOver8), maxValue));
+		__m128 numerator = FastSelect(isUpperHalf, _mm_sub_ps(minValue, maxValue), minValue);
+		__m128 denominator = FastSelect(isUpperHalf, _mm_add_ps(minValue, maxValue), maxValue);
+		__m128 t = _mm_div_ps(numerator, _mm_max_ps(denominator, _mm_set1_ps(FLT_MIN)));
+
+		__m128 z = _mm_mul_ps(t, t);
+		__m128 result = FastPolynomial(z, FastPolynomial(z, FastPolynomial(z, _mm_set1_ps(FastAtan9), FastAtan7), FastAtan5), FastAtan3);
+		result = _mm_add_ps(t, _mm_mul_ps(_mm_mul_ps(t, z), result));
+
+		// The octant adds a multiple of PI/4, whose high part is exact so that only the last add rounds at the result scale.
+		__m128 octant = _mm_and_ps(isUpperHalf, _mm_set1_ps(1.f));
+		__m128 isSwapped = _mm_cmpgt_ps(absY, absX);
+		octant = FastSelect(isSwapped, _mm_sub_ps(_mm_set1_ps(2.f), octant), octant);
+		result = _mm_xor_ps(result, _mm_and_ps(isSwapped, signMask));
+		__m128 isNegativeX = _mm_cmplt_ps(InX, _mm_setzero_ps());
+		octant = FastSelect(isNegativeX, _mm_sub_ps(_mm_set1_ps(4.f), octant), octant);
+		result = _mm_xor_ps(result, _mm_and_ps(isNegativeX, signMask));
+		result = _mm_add_ps(_mm_mul_ps(octant, _mm_set1_ps(FastPIOver4High)), _mm_add_ps(result, _mm_mul_ps(octant, _mm_set1_ps(FastPIOver4Low))));
+		return _mm_or_ps(result, _mm_and_ps(InY, signMask));
+	}
+
+	static FORCEINLINE __m128 FastInvSqrt(__m128 InValue)
+	{
+		__m128 estimate = _mm_rsqrt_ps(InValue);
+		__m128 step = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), InValue), _mm_mul_ps(estimate, estimate)));
+		return _mm_mul_ps(estimate, step);
+	}
+
+	static FORCEINLINE __m128 FastExp(__m128 InValue)
+	{
+		__m128 x = _mm_min_ps(_mm_max_ps(InValue, _mm_set1_ps(FastExpMin)), _mm_set1_ps(FastExpMax));
+		__m128 exponent = FastRound(_mm_mul_ps(x, _mm_set1_ps(FastLog2E)));
+		x = _mm_sub_ps(x, _mm_mul_ps(exponent, _mm_set1_ps(FastLn2High)));
+		x = _mm_sub_ps(x, _mm_mul_ps(exponent, _mm_set1_ps(FastLn2Low)));
+
+		__m128 z = _mm_mul_ps(x, x);
+		__m128 result = FastPolynomial(x, FastPolynomial(x, _mm_set1_ps(FastExp7), FastExp6), FastExp5);
+		result = FastPolynomial(x, FastPolynomial(x, FastPolynomial(x, result, FastExp4), FastExp3), FastExp2);
+		result = _mm_add_ps(_mm_add_ps(_mm_set1_ps(1.f), x), _mm_mul_ps(z, result));
+
+		__m128i scale = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(exponent), _mm_set1_epi32(127)), 23);
+		return _mm_mul_ps(result, _mm_castsi128_ps(scale));
+	}
+
+	static FORCEINLINE __m128 FastLog(__m128 InValue)
+	{
+		__m128i bits = _mm_castps_si128(InValue);
+		__m128i exponentInt = _mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0xff)), _mm_set1_epi32(126));
+		__m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32((int)0x807fffffu)), _mm_set1_epi32(0x3f000000)));
+
+		// Mantissas below sqrt(1/2) are doubled so that x stays around zero.
+		__m128 isLow = _mm_cmplt_ps(mantissa, _mm_set1_ps(FastSqrtHalf));
+		__m128 exponent = _mm_sub_ps(_mm_cvtepi32_ps(exponentInt), _mm_and_ps(isLow, _mm_set1_ps(1.f)));
+		__m128 x = _mm_add_ps(_mm_sub_ps(mantissa, _mm_set1_ps(1.f)), _mm_and_ps(isLow, mantissa));
+
+		__m128 z = _mm_mul_ps(x, x);
+		__m128 polynomial = _mm_set1_ps(FastLogCoefficients[0]);
+		for (int i = 1; i < 9; ++i)
+		{
+			polynomial = FastPolynomial(x, polynomial, FastLogCoefficients[i]);
+		}
+		__m128 y = _mm_mul_ps(_mm_mul_ps(x, z), polynomial);
+		y = _mm_add_ps(y, _mm_mul_ps(exponent, _mm_set1_ps(FastLn2Low)));
+		y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+		return _mm_add_ps(_mm_add_ps(x, y), _mm_mul_ps(exponent, _mm_set1_ps(FastLn2High)));
+	}
+#endif
+
+private:
+	// Coefficients shared by the scalar and batch versions.
+	static constexpr float FastTwoOverPI = 0.636619772367581343f;
+	static constexpr float FastHalfPIHigh = 1.5703125f;
+	static constexpr float FastHalfPIMid = 4.837512969970703125e-4f;
+	static constexpr float FastHalfPILow = 7.54978995489188216e-8f;
+	static constexpr float FastSin3 = -1.6666654611e-1f;
+	static constexpr float FastSin5 = 8.3321608736e-3f;
+	static constexpr float FastSin7 = -1.9515295891e-4f;
+	static constexpr float FastCos4 = 4.166664568298827e-2f;
+	static constexpr float FastCos6 = -1.388731625493765e-3f;
+	static constexpr float FastCos8 = 2.443315711809948e-5f;
+	static constexpr float FastTanPIOver8 = 0.414213562373095f;
+	static constexpr float FastPIOver4High = 0.78515625f;
+	static constexpr float FastPIOver4Low = 2.4191339744830961566e-4f;
+	static constexpr float FastAtan3 = -3.33329491539e-1f;
+	static constexpr float FastAtan5 = 1.99777106478e-1f;
+	static constexpr float FastAtan7 = -1.38776856032e-1f;
+	static constexpr float FastAtan9 = 8.05374449538e-2f;
+	static constexpr float FastLog2E = 1.44269504088896341f;
+	static constexpr float FastLn2High = 0.693359375f;
+	static constexpr float FastLn2Low = -2.12194440e-4f;
+	static constexpr float FastExpMin = -87.3365447f;
+	static constexpr float FastExpMax = 88.3762626f;
+	static constexpr float FastExp2 = 5.0000001201e-1f;
+	static constexpr float FastExp3 = 1.6666665459e-1f;
+	static constexpr float FastExp4 = 4.1665795894e-2f;
+	static constexpr float FastExp5 = 8.3334519073e-3f;
+	static constexpr float FastExp6 = 1.3981999507e-3f;
+	static constexpr float FastExp7 = 1.9875691500e-4f;
+	static constexpr float FastSqrtHalf = 0.707106781186547524f;
+	static constexpr float FastLogCoefficients[9] = { 7.0376836292e-2f, -1.1514610310e-1f, 1.1676998740e-1f, -1.2420140846e-1f, 1.4249322787e-1f, -1.6668057665e-1f, 2.0000714765e-1f, -2.4999993993e-1f, 3.3333331174e-1f };
+
+	// One value of the batch versions, for their tails and the scalar build.
+	static FORCEINLINE float FastExpScalar(float InFloat)
+	{
+#if defined(MATH_SIMD_SSE2)
+		return _mm_cvtss_f32(FastExp(_mm_set_ss(InFloat)));
+#else
+		float x = Clamp(InFloat, FastExpMin, FastExpMax);
+		int exponent = FastRoundToInt(x * FastLog2E);
+		float reduced = (x - exponent * FastLn2High) - exponent * FastLn2Low;
+		return FastExpPolynomial(reduced) * FastAsFloat((UINT32)(exponent + 127) << 23);
+#endif
+	}
+
+	static FORCEINLINE float FastLogScalar(float InFloat)
+	{
+#if defined(MATH_SIMD_SSE2)
+		return _mm_cvtss_f32(FastLog(_mm_set_ss(InFloat)));
+#else
+		UINT32 bits = FastAsUInt(InFloat);
+		int exponent = (int)((bits >> 23) & 0xff) - 126;
+		float mantissa = FastAsFloat((bits & 0x807fffffu) | 0x3f000000u);
+		// Mantissas below sqrt(1/2) are doubled so that x stays around zero.
+		float x = mantissa - 1.f;
+		if (mantissa < FastSqrtHalf)
+		{
+			exponent--;
+			x += mantissa;
+		}
+		return FastLogPolynomial(x, (float)exponent);
+#endif
+	}
+
+#if defined(MATH_SIMD_SSE2)
+	// Half away from zero.
+	static FORCEINLINE __m128 FastRound(__m128 InValue)
+	{
+		__m128 half = _mm_or_ps(_mm_and_ps(InValue, _mm_set1_ps(-0.f)), _mm_set1_ps(0.5f));
+		return _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_add_ps(InValue, half)));
+	}
+
+	static FORCEINLINE __m128 FastSelect(__m128 InMask, __m128 InTrue, __m128 InFalse)
+	{
+		return _mm_or_ps(_mm_and_ps(InMask, InTrue), _mm_andnot_ps(InMask, InFalse));
+	}
+
+	// One Horner step : InHigher * InX + InC.
+	static FORCEINLINE __m128 FastPolynomial(__m128 InX, __m128 InHigher, float InC)
+	{
+		return _mm_add_ps(_mm_mul_ps(InHigher, InX), _mm_set1_ps(InC));
+	}
+#else
+	static FORCEINLINE UINT32 FastAsUInt(float InFloat)
+	{
+		UINT32 result;
+		memcpy(&result, &InFloat, sizeof(result));
+		return result;
+	}
+
+	static FORCEINLINE float FastAsFloat(UINT32 InBits)
+	{
+		float result;
+		memcpy(&result, &InBits, sizeof(result));
+		return result;
+	}
+
+	// Half away from zero like the SSE kernels.
+	static FORCEINLINE int FastRoundToInt(float InFloat)
+	{
+		return TruncToInt(InFloat + copysignf(0.5f, InFloat));
+	}
+
+	static FORCEINLINE float FastReduceHalfPI(float InRadian, float InQuadrant)
+	{
+		return ((InRadian - InQuadrant * FastHalfPIHigh) - InQuadrant * FastHalfPIMid) - InQuadrant * FastHalfPILow;
+	}
+
+	static FORCEINLINE float FastSinPolynomial(float InX)
+	{
+		float z = InX * InX;
+		return InX + InX * z * (FastSin3 + z * (FastSin5 + z * FastSin7));
+	}
+
+	static FORCEINLINE float FastCosPolynomial(float InX)
+	{
+		float z = InX * InX;
+		return 1.f - 0.5f * z + z * z * (FastCos4 + z * (FastCos6 + z * FastCos8));
+	}
+
+	static FORCEINLINE float FastAtanPolynomial(float InX)
+	{
+		float z = InX * InX;
+		return InX + InX * z * (FastAtan3 + z * (FastAtan5 + z * (FastAtan7 + z * FastAtan9)));
+	}
+
+	static FORCEINLINE float FastExpPolynomial(float InX)
+	{
+		float z = InX * InX;
+		return 1.f + InX + z * (FastExp2 + InX * (FastExp3 + InX * (FastExp4 + InX * (FastExp5 + InX * (FastExp6 + InX * FastExp7)))));
+	}
+
+	static FORCEINLINE float FastLogPolynomial(float InX, float InExponent)
+	{
+		float z = InX * InX;
+		float polynomial = FastLogCoefficients[0];
+		for (int i = 1; i < 9; ++i)
+		{
+			polynomial = polynomial * InX + FastLogCoefficients[i];
+		}
+		float y = InX * z * polynomial + InExponent * FastLn2Low - 0.5f * z;
+		return InX + y + InExponent * FastLn2High;
+	}
+#endif
 };
 
 }
\ No newline at end of file
@@ -7,16 +7,16 @@ struct Matrix2x2
 {
 public:
 	//  
-	FORCEINLINE Matrix2x2();
-	FORCEINLINE explicit Matrix2x2(const Vector2& InCol0, const Vector2& InCol1);
-	FORCEINLINE explicit Matrix2x2(float In00, float In01, float In10, float In11);
+	FORCEINLINE constexpr Matrix2x2() = default;
+	FORCEINLINE constexpr explicit Matrix2x2(const Vector2& InCol0, const Vector2& InCol1);
+	FORCEINLINE constexpr explicit Matrix2x2(float In00, float In01, float In10, float In11);
 
 	//  
-	FORCEINLINE const Vector2& operator[](BYTE InIndex) const;
-	FORCEINLINE Vector2& operator[](BYTE InIndex);
-	FORCEINLINE Matrix2x2 operator*(float InScalar) const;
-	FORCEINLINE Matrix2x2 operator*(const Matrix2x2& InMatrix) const;
-	FORCEINLINE Vector2 operator*(const Vector2& InVector) const;
+	FORCEINLINE constexpr const Vector2& operator[](BYTE InIndex) const;
+	FORCEINLINE constexpr Vector2& operator[](BYTE InIndex);
+	FORCEINLINE constexpr Matrix2x2 operator*(float InScalar) const;
+	FORCEINLINE constexpr Matrix2x2 operator*(const Matrix2x2& InMatrix) const;
+	FORCEINLINE constexpr Vector2 operator*(const Vector2& InVector) const;
 	FORCEINLINE friend Vector2 operator*=(Vector2& InVector, const Matrix2x2& InMatrix)
 	{
 		InVector = InMatrix * InVector;
@@ -25,7 +25,10 @@ public:
 
 	// Լ 
 	FORCEINLINE void SetIdentity();
-	FORCEINLINE Matrix2x2 Tranpose() const;
+	FORCEINLINE constexpr Matrix2x2 Tranpose() const;
+	FORCEINLINE constexpr float Determinant() const;
+	//  : Ư ̸   ȯ
+	FORCEINLINE constexpr Matrix2x2 Inverse() const;
 
 	std::vector<std::string> ToStrings() const;
 
@@ -37,31 +40,22 @@ public:
 	Vector2 Cols[2] = { Vector2::UnitX, Vector2::UnitY };
 };
 
-FORCEINLINE Matrix2x2::Matrix2x2()
+FORCEINLINE constexpr Matrix2x2::Matrix2x2(const Vector2& InCol0, const Vector2& InCol1) : Cols{ InCol0, InCol1 }
 {
 }
 
-FORCEINLINE Matrix2x2::Matrix2x2(const Vector2& InCol0, const Vector2& InCol1)
+FORCEINLINE constexpr Matrix2x2::Matrix2x2(float In00, float In01, float In10, float In11) : Cols{ Vector2(In00, In01), Vector2(In10, In11) }
 {
-	Cols[0] = InCol0;
-	Cols[1] = InCol1;
 }
 
-FORCEINLINE Matrix2x2::Matrix2x2(float In00, float In01, float In10, float In11)
-{
-	Cols[0][0] = In00;
-	Cols[0][1] = In01;
-
-	Cols[1][0] = In10;
-	Cols[1][1] = In11;
-}
+inline constexpr Matrix2x2 Matrix2x2::Identity(Vector2(1.f, 0.f), Vector2(0.f, 1.f));
 
 FORCEINLINE void Matrix2x2::SetIdentity()
 {
 	*this = Matrix2x2::Identity;
 }
 
-FORCEINLINE Matrix2x2 Matrix2x2::Tranpose() const
+FORCEINLINE constexpr Matrix2x2 Matrix2x2::Tranpose() const
 {
 	return Matrix2x2(
 		Vector2(Cols[0].X, Cols[1].X),
@@ -69,17 +63,17 @@ FORCEINLINE Matrix2x2 Matrix2x2::Tranpose() const
 	);
 }
 
-FORCEINLINE const Vector2& Matrix2x2::operator[](BYTE InIndex) const
+FORCEINLINE constexpr const Vector2& Matrix2x2::operator[](BYTE InIndex) const
 {
 	return (InIndex < Rank) ? Cols[InIndex] : Cols[0];
 }
 
-FORCEINLINE Vector2& Matrix2x2::operator[](BYTE InIndex)
+FORCEINLINE constexpr Vector2& Matrix2x2::operator[](BYTE InIndex)
 {
 	return (InIndex < Rank) ? Cols[InIndex] : Cols[0];
 }
 
-FORCEINLINE Matrix2x2 Matrix2x2::operator*(float InScalar) const
+FORCEINLINE constexpr Matrix2x2 Matrix2x2::operator*(float InScalar) const
 {
 	return Matrix2x2(
 		Cols[0] * InScalar,
@@ -87,7 +81,7 @@ FORCEINLINE Matrix2x2 Matrix2x2::operator*(float InScalar) const
 	);
 }
 
-FORCEINLINE Matrix2x2 Matrix2x2::operator*(const Matrix2x2 &InMatrix) const
+FORCEINLINE constexpr Matrix2x2 Matrix2x2::operator*(const Matrix2x2 &InMatrix) const
 {
 	Matrix2x2 tpMat = Tranpose();
 	return Matrix2x2(
@@ -96,7 +90,7 @@ FORCEINLINE Matrix2x2 Matrix2x2::operator*(const Matrix2x2 &InMatrix) const
 	);
 }
 
-FORCEINLINE Vector2 Matrix2x2::operator*(const Vector2& InVector) const
+FORCEINLINE constexpr Vector2 Matrix2x2::operator*(const Vector2& InVector) const
 {
 	Matrix2x2 tpMat = Tranpose();
 	return Vector2(
@@ -105,4 +99,24 @@ FORCEINLINE Vector2 Matrix2x2::operator*(const Vector2& InVector) const
 	);
 }
 
+FORCEINLINE constexpr float Matrix2x2::Determinant() const
+{
+	return Cols[0].X * Cols[1].Y - Cols[1].X * Cols[0].Y;
+}
+
+FORCEINLINE constexpr Matrix2x2 Matrix2x2::Inverse() const
+{
+	float determinant = Determinant();
+	if (determinant == 0.f)
+	{
+		return Matrix2x2::Identity;
+	}
+
+	float invDeterminant = 1.f / determinant;
+	return Matrix2x2(
+		Vector2(Cols[1].Y, -Cols[0].Y) * invDeterminant,
+		Vector2(-Cols[1].X, Cols[0].X) * invDeterminant
+	);
+}
+
 }
\ No newline at end of file
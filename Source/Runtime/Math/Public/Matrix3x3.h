@@ -7,17 +7,17 @@ struct Matrix3x3
 {
 public:
 	//  
-	FORCEINLINE Matrix3x3();
-	FORCEINLINE explicit Matrix3x3(const Vector3& InCol0, const Vector3& InCol1, const Vector3& InCol2);
-	FORCEINLINE explicit Matrix3x3(float In00, float In01, float In02, float In10, float In11, float In12, float In20, float In21, float In22);
+	FORCEINLINE constexpr Matrix3x3() = default;
+	FORCEINLINE constexpr explicit Matrix3x3(const Vector3& InCol0, const Vector3& InCol1, const Vector3& InCol2);
+	FORCEINLINE constexpr explicit Matrix3x3(float In00, float In01, float In02, float In10, float In11, float In12, float In20, float In21, float In22);
 
 	//  
-	FORCEINLINE const Vector3& operator[](BYTE InIndex) const;
-	FORCEINLINE Vector3& operator[](BYTE InIndex);
+	FORCEINLINE constexpr const Vector3& operator[](BYTE InIndex) const;
+	FORCEINLINE constexpr Vector3& operator[](BYTE InIndex);
 
-	FORCEINLINE Matrix3x3 operator*(float InScalar) const;
-	FORCEINLINE Matrix3x3 operator*(const Matrix3x3& InMatrix) const;
-	FORCEINLINE Vector3 operator*(const Vector3& InVector) const;
+	FORCEINLINE constexpr Matrix3x3 operator*(float InScalar) const;
+	FORCEINLINE constexpr Matrix3x3 operator*(const Matrix3x3& InMatrix) const;
+	FORCEINLINE constexpr Vector3 operator*(const Vector3& InVector) const;
 	FORCEINLINE friend Vector3 operator*=(Vector3& InVector, const Matrix3x3& InMatrix)
 	{
 		InVector = InMatrix * InVector;
@@ -32,7 +32,10 @@ public:
 
 	// Լ 
 	FORCEINLINE void SetIdentity();
-	FORCEINLINE Matrix3x3 Tranpose() const;
+	FORCEINLINE constexpr Matrix3x3 Tranpose() const;
+	FORCEINLINE constexpr float Determinant() const;
+	//  : Ư ̸   ȯ
+	FORCEINLINE constexpr Matrix3x3 Inverse() const;
 
 	std::vector<std::string> ToStrings() const;
 
@@ -44,38 +47,22 @@ public:
 	Vector3 Cols[3] = { Vector3::UnitX, Vector3::UnitY, Vector3::UnitZ };
 };
 
-FORCEINLINE Matrix3x3::Matrix3x3()
+FORCEINLINE constexpr Matrix3x3::Matrix3x3(const Vector3& InCol0, const Vector3& InCol1, const Vector3& InCol2) : Cols{ InCol0, InCol1, InCol2 }
 {
 }
 
-FORCEINLINE Matrix3x3::Matrix3x3(const Vector3& InCol0, const Vector3& InCol1, const Vector3& InCol2)
+FORCEINLINE constexpr Matrix3x3::Matrix3x3(float In00, float In01, float In02, float In10, float In11, float In12, float In20, float In21, float In22) : Cols{ Vector3(In00, In01, In02), Vector3(In10, In11, In12), Vector3(In20, In21, In22) }
 {
-	Cols[0] = InCol0;
-	Cols[1] = InCol1;
-	Cols[2] = InCol2;
 }
 
-FORCEINLINE Matrix3x3::Matrix3x3(float In00, float In01, float In02, float In10, float In11, float In12, float In20, float In21, float In22)
-{
-	Cols[0][0] = In00;
-	Cols[0][1] = In01;
-	Cols[0][2] = In02;
-
-	Cols[1][0] = In10;
-	Cols[1][1] = In11;
-	Cols[1][2] = In12;
-
-	Cols[2][0] = In20;
-	Cols[2][1] = In21;
-	Cols[2][2] = In22;
-}
+inline constexpr Matrix3x3 Matrix3x3::Identity(Vector3(1.f, 0.f, 0.f), Vector3(0.f, 1.f, 0.f), Vector3(0.f, 0.f, 1.f));
 
 FORCEINLINE void Matrix3x3::SetIdentity()
 {
 	*this = Matrix3x3::Identity;
 }
 
-FORCEINLINE Matrix3x3 Matrix3x3::Tranpose() const
+FORCEINLINE constexpr Matrix3x3 Matrix3x3::Tranpose() const
 {
 	return Matrix3x3(
 		Vector3(Cols[0].X, Cols[1].X, Cols[2].X),
@@ -84,17 +71,17 @@ FORCEINLINE Matrix3x3 Matrix3x3::Tranpose() const
 	);
 }
 
-FORCEINLINE const Vector3& Matrix3x3::operator[](BYTE InIndex) const
+FORCEINLINE constexpr const Vector3& Matrix3x3::operator[](BYTE InIndex) const
 {
 	return (InIndex < Rank) ? Cols[InIndex] : Cols[0];
 }
 
-FORCEINLINE Vector3& Matrix3x3::operator[](BYTE InIndex)
+FORCEINLINE constexpr Vector3& Matrix3x3::operator[](BYTE InIndex)
 {
 	return (InIndex < Rank) ? Cols[InIndex] : Cols[0];
 }
 
-FORCEINLINE Matrix3x3 Matrix3x3::operator*(float InScalar) const
+FORCEINLINE constexpr Matrix3x3 Matrix3x3::operator*(float InScalar) const
 {
 	return Matrix3x3(
 		Cols[0] * InScalar,
@@ -103,7 +90,7 @@ FORCEINLINE Matrix3x3 Matrix3x3::operator*(float InScalar) const
 	);
 }
 
-FORCEINLINE Matrix3x3 Matrix3x3::operator*(const Matrix3x3 &InMatrix) const
+FORCEINLINE constexpr Matrix3x3 Matrix3x3::operator*(const Matrix3x3 &InMatrix) const
 {
 	Matrix3x3 tpMat = Tranpose();
 	return Matrix3x3(
@@ -114,7 +101,7 @@ FORCEINLINE Matrix3x3 Matrix3x3::operator*(const Matrix3x3 &InMatrix) const
 
 }
 
-FORCEINLINE Vector3 Matrix3x3::operator*(const Vector3& InVector) const
+FORCEINLINE constexpr Vector3 Matrix3x3::operator*(const Vector3& InVector) const
 {
 	Matrix3x3 tpMat = Tranpose();
 	return Vector3(
@@ -132,4 +119,29 @@ FORCEINLINE Vector2 Matrix3x3::operator*(const Vector2& InVector) const
 	return v3.ToVector2();
 }
 
+FORCEINLINE constexpr float Matrix3x3::Determinant() const
+{
+	return Cols[0].Dot(Cols[1].Cross(Cols[2]));
+}
+
+FORCEINLINE constexpr Matrix3x3 Matrix3x3::Inverse() const
+{
+	//     Ľ  
+	Vector3 row0 = Cols[1].Cross(Cols[2]);
+	Vector3 row1 = Cols[2].Cross(Cols[0]);
+	Vector3 row2 = Cols[0].Cross(Cols[1]);
+	float determinant = Cols[0].Dot(row0);
+	if (determinant == 0.f)
+	{
+		return Matrix3x3::Identity;
+	}
+
+	float invDeterminant = 1.f / determinant;
+	return Matrix3x3(
+		Vector3(row0.X, row1.X, row2.X) * invDeterminant,
+		Vector3(row0.Y, row1.Y, row2.Y) * invDeterminant,
+		Vector3(row0.Z, row1.Z, row2.Z) * invDeterminant
+	);
+}
+
 }
\ No newline at end of file
@@ -7,12 +7,12 @@ struct Matrix4x4
 {
 public:
 	//  
-	FORCEINLINE Matrix4x4();
-	FORCEINLINE explicit Matrix4x4(const Vector4& InCol0, const Vector4& InCol1, const Vector4& InCol2, const Vector4& InCol3);
+	FORCEINLINE constexpr Matrix4x4() = default;
+	FORCEINLINE constexpr explicit Matrix4x4(const Vector4& InCol0, const Vector4& InCol1, const Vector4& InCol2, const Vector4& InCol3);
 
 	//  
-	FORCEINLINE const Vector4& operator[](BYTE InIndex) const;
-	FORCEINLINE Vector4& operator[](BYTE InIndex);
+	FORCEINLINE constexpr const Vector4& operator[](BYTE InIndex) const;
+	FORCEINLINE constexpr Vector4& operator[](BYTE InIndex);
 	FORCEINLINE Matrix4x4 operator*(float InScalar) const;
 	FORCEINLINE Matrix4x4 operator*(const Matrix4x4& InMatrix) const;
 	FORCEINLINE Vector4 operator*(const Vector4& InVector) const;
@@ -31,6 +31,18 @@ public:
 	// Լ 
 	FORCEINLINE void SetIdentity();
 	FORCEINLINE Matrix4x4 Tranpose() const;
+	FORCEINLINE float Determinant() const;
+
+	//  : Ư ̸   ȯ
+	FORCEINLINE Matrix4x4 Inverse() const;
+	// ȸ ̵ ִ ü ȯ 
+	FORCEINLINE Matrix4x4 InverseRigid() const;
+	//   (0, 0, 0, 1)  ȯ 
+	FORCEINLINE Matrix4x4 InverseAffine() const;
+	// 밢 а ̵ ִ    
+	FORCEINLINE Matrix4x4 InverseOrthographic() const;
+	//   (0, 0, e, 0)̰  °  ߽ ̵ ִ    
+	FORCEINLINE Matrix4x4 InversePerspective() const;
 
 	std::vector<std::string> ToStrings() const;
 
@@ -40,19 +52,23 @@ public:
 
 	//  
 	Vector4 Cols[4] = { Vector4::UnitX, Vector4::UnitY, Vector4::UnitZ, Vector4::UnitW };
+
+private:
+#if defined(MATH_SIMD_SSE2)
+	//  ϳ (00, 01, 10, 11)   2x2  
+	static FORCEINLINE __m128 Multiply2x2(__m128 InA, __m128 InB);
+	static FORCEINLINE __m128 AdjugateMultiply2x2(__m128 InA, __m128 InB);
+	static FORCEINLINE __m128 MultiplyAdjugate2x2(__m128 InA, __m128 InB);
+	static FORCEINLINE __m128 Cross(__m128 InA, __m128 InB);
+	static FORCEINLINE Matrix4x4 InverseAffine(__m128 InCol0, __m128 InCol1, __m128 InCol2, __m128 InCol3, bool InIsRigid);
+#endif
 };
 
-FORCEINLINE Matrix4x4::Matrix4x4()
+FORCEINLINE constexpr Matrix4x4::Matrix4x4(const Vector4& InCol0, const Vector4& InCol1, const Vector4& InCol2, const Vector4& InCol3) : Cols{ InCol0, InCol1, InCol2, InCol3 }
 {
 }
 
-FORCEINLINE Matrix4x4::Matrix4x4(const Vector4& InCol0, const Vector4& InCol1, const Vector4& InCol2, const Vector4& InCol3)
-{
-	Cols[0] = InCol0;
-	Cols[1] = InCol1;
-	Cols[2] = InCol2;
-	Cols[3] = InCol3;
-}
+inline constexpr Matrix4x4 Matrix4x4::Identity(Vector4(1.f, 0.f, 0.f, 0.f), Vector4(0.f, 1.f, 0.f, 0.f), Vector4(0.f, 0.f, 1.f, 0.f), Vector4(0.f, 0.f, 0.f, 1.f));
 
 FORCEINLINE void Matrix4x4::SetIdentity()
 {
@@ -61,20 +77,29 @@ FORCEINLINE void Matrix4x4::SetIdentity()
 
 FORCEINLINE Matrix4x4 Matrix4x4::Tranpose() const
 {
+#if defined(MATH_SIMD_SSE2)
+	__m128 col0 = Cols[0].ToRegister();
+	__m128 col1 = Cols[1].ToRegister();
+	__m128 col2 = Cols[2].ToRegister();
+	__m128 col3 = Cols[3].ToRegister();
+	_MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+	return Matrix4x4(Vector4(col0), Vector4(col1), Vector4(col2), Vector4(col3));
+#else
 	return Matrix4x4(
 		Vector4(Cols[0].X, Cols[1].X, Cols[2].X, Cols[3].X),
 		Vector4(Cols[0].Y, Cols[1].Y, Cols[2].Y, Cols[3].Y),
 		Vector4(Cols[0].Z, Cols[1].Z, Cols[2].Z, Cols[3].Z),
 		Vector4(Cols[0].W, Cols[1].W, Cols[2].W, Cols[3].W)
 	);
+#endif
 }
 
-FORCEINLINE const Vector4& Matrix4x4::operator[](BYTE InIndex) const
+FORCEINLINE constexpr const Vector4& Matrix4x4::operator[](BYTE InIndex) const
 {
 	return (InIndex < Rank) ? Cols[InIndex] : Cols[0];
 }
 
-FORCEINLINE Vector4& Matrix4x4::operator[](BYTE InIndex)
+FORCEINLINE constexpr Vector4& Matrix4x4::operator[](BYTE InIndex)
 {
 	return (InIndex < Rank) ? Cols[InIndex] : Cols[0];
 }
@@ -89,34 +114,320 @@ FORCEINLINE Matrix4x4 Matrix4x4::operator*(float InScalar) const
 	);
 }
 
+//  켱  :          ̹Ƿ ġ ʿ 
 FORCEINLINE Matrix4x4 Matrix4x4::operator*(const Matrix4x4 &InMatrix) const
 {
-	Matrix4x4 tpMat = Tranpose();
+#if defined(MATH_SIMD_AVX2)
+	//    Ϳ Բ 
+	__m256 col0 = _mm256_broadcast_ps((const __m128*)&Cols[0].X);
+	__m256 col1 = _mm256_broadcast_ps((const __m128*)&Cols[1].X);
+	__m256 col2 = _mm256_broadcast_ps((const __m128*)&Cols[2].X);
+	__m256 col3 = _mm256_broadcast_ps((const __m128*)&Cols[3].X);
+
+	Matrix4x4 result;
+	for (BYTE i = 0; i < Rank; i += 2)
+	{
+		const Vector4& lower = InMatrix.Cols[i];
+		const Vector4& upper = InMatrix.Cols[i + 1];
+		__m256 sum = _mm256_mul_ps(col0, _mm256_setr_ps(lower.X, lower.X, lower.X, lower.X, upper.X, upper.X, upper.X, upper.X));
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(col1, _mm256_setr_ps(lower.Y, lower.Y, lower.Y, lower.Y, upper.Y, upper.Y, upper.Y, upper.Y)));
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(col2, _mm256_setr_ps(lower.Z, lower.Z, lower.Z, lower.Z, upper.Z, upper.Z, upper.Z, upper.Z)));
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(col3, _mm256_setr_ps(lower.W, lower.W, lower.W, lower.W, upper.W, upper.W, upper.W, upper.W)));
+		_mm256_storeu_ps(&result.Cols[i].X, sum);
+	}
+	return result;
+#else
 	return Matrix4x4(
-		Vector4(tpMat[0].Dot(InMatrix[0]), tpMat[1].Dot(InMatrix[0]), tpMat[2].Dot(InMatrix[0]), tpMat[3].Dot(InMatrix[0])),
-		Vector4(tpMat[0].Dot(InMatrix[1]), tpMat[1].Dot(InMatrix[1]), tpMat[2].Dot(InMatrix[1]), tpMat[3].Dot(InMatrix[1])),
-		Vector4(tpMat[0].Dot(InMatrix[2]), tpMat[1].Dot(InMatrix[2]), tpMat[2].Dot(InMatrix[2]), tpMat[3].Dot(InMatrix[2])),
-		Vector4(tpMat[0].Dot(InMatrix[3]), tpMat[1].Dot(InMatrix[3]), tpMat[2].Dot(InMatrix[3]), tpMat[3].Dot(InMatrix[3]))
+		*this * InMatrix[0],
+		*this * InMatrix[1],
+		*this * InMatrix[2],
+		*this * InMatrix[3]
 	);
+#endif
 }
 
 FORCEINLINE Vector4 Matrix4x4::operator*(const Vector4& InVector) const
 {
-	Matrix4x4 tpMat = Tranpose();
+#if defined(MATH_SIMD_SSE2)
+	__m128 sum = _mm_mul_ps(Cols[0].ToRegister(), _mm_set1_ps(InVector.X));
+	sum = _mm_add_ps(sum, _mm_mul_ps(Cols[1].ToRegister(), _mm_set1_ps(InVector.Y)));
+	sum = _mm_add_ps(sum, _mm_mul_ps(Cols[2].ToRegister(), _mm_set1_ps(InVector.Z)));
+	sum = _mm_add_ps(sum, _mm_mul_ps(Cols[3].ToRegister(), _mm_set1_ps(InVector.W)));
+	return Vector4(sum);
+#else
 	return Vector4(
-		tpMat[0].Dot(InVector),
-		tpMat[1].Dot(InVector),
-		tpMat[2].Dot(InVector),
-		tpMat[3].Dot(InVector)
+		Cols[0].X * InVector.X + Cols[1].X * InVector.Y + Cols[2].X * InVector.Z + Cols[3].X * InVector.W,
+		Cols[0].Y * InVector.X + Cols[1].Y * InVector.Y + Cols[2].Y * InVector.Z + Cols[3].Y * InVector.W,
+		Cols[0].Z * InVector.X + Cols[1].Z * InVector.Y + Cols[2].Z * InVector.Z + Cols[3].Z * InVector.W,
+		Cols[0].W * InVector.X + Cols[1].W * InVector.Y + Cols[2].W * InVector.Z + Cols[3].W * InVector.W
 	);
+#endif
 }
 
 FORCEINLINE Vector3 Matrix4x4::operator*(const Vector3& InVector) const
 {
-	Vector4 v4(InVector);
-	v4 *= *this;
+	return (*this * Vector4(InVector)).ToVector3();
+}
+
+FORCEINLINE float Matrix4x4::Determinant() const
+{
+	//    Ʒ   2x2 Ľ 
+	float s0 = Cols[0].X * Cols[1].Y - Cols[0].Y * Cols[1].X;
+	float s1 = Cols[0].X * Cols[2].Y - Cols[0].Y * Cols[2].X;
+	float s2 = Cols[0].X * Cols[3].Y - Cols[0].Y * Cols[3].X;
+	float s3 = Cols[1].X * Cols[2].Y - Cols[1].Y * Cols[2].X;
+	float s4 = Cols[1].X * Cols[3].Y - Cols[1].Y * Cols[3].X;
+	float s5 = Cols[2].X * Cols[3].Y - Cols[2].Y * Cols[3].X;
+	float c0 = Cols[0].Z * Cols[1].W - Cols[0].W * Cols[1].Z;
+	float c1 = Cols[0].Z * Cols[2].W - Cols[0].W * Cols[2].Z;
+	float c2 = Cols[0].Z * Cols[3].W - Cols[0].W * Cols[3].Z;
+	float c3 = Cols[1].Z * Cols[2].W - Cols[1].W * Cols[2].Z;
+	float c4 = Cols[1].Z * Cols[3].W - Cols[1].W * Cols[3].Z;
+	float c5 = Cols[2].Z * Cols[3].W - Cols[2].W * Cols[3].Z;
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+FORCEINLINE Matrix4x4 Matrix4x4::Inverse() const
+{
+#if defined(MATH_SIMD_SSE2)
+	// 2x2  ķ    ϴ 
+	//  ó ٷ ġ    Ƿ  ״    
+	__m128 col0 = Cols[0].ToRegister();
+	__m128 col1 = Cols[1].ToRegister();
+	__m128 col2 = Cols[2].ToRegister();
+	__m128 col3 = Cols[3].ToRegister();
+
+	__m128 a = _mm_movelh_ps(col0, col1);
+	__m128 b = _mm_movehl_ps(col1, col0);
+	__m128 c = _mm_movelh_ps(col2, col3);
+	__m128 d = _mm_movehl_ps(col3, col2);
+
+	// (|A|, |B|, |C|, |D|)
+	__m128 subDeterminants = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(col0, col2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(col1, col3, _MM_SHUFFLE(3, 1, 3, 1))),
+		_mm_mul_ps(_mm_shuffle_ps(col0, col2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(col1, col3, _MM_SHUFFLE(2, 0, 2, 0)))
+	);
+	__m128 detA = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+	__m128 detB = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+	__m128 detC = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+	__m128 detD = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m128 adjDC = AdjugateMultiply2x2(d, c);
+	__m128 adjAB = AdjugateMultiply2x2(a, b);
+	__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Multiply2x2(b, adjDC));
+	__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Multiply2x2(c, adjAB));
+	__m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), MultiplyAdjugate2x2(d, adjAB));
+	__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), MultiplyAdjugate2x2(a, adjDC));
+
+	// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+	__m128 trace = _mm_mul_ps(adjAB, _mm_shuffle_ps(adjDC, adjDC, _MM_SHUFFLE(3, 1, 2, 0)));
+	trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+	trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+	__m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+	if (_mm_cvtss_f32(determinant) == 0.f)
+	{
+		return Matrix4x4::Identity;
+	}
+
+	__m128 invDeterminant = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), determinant);
+	x = _mm_mul_ps(x, invDeterminant);
+	y = _mm_mul_ps(y, invDeterminant);
+	z = _mm_mul_ps(z, invDeterminant);
+	w = _mm_mul_ps(w, invDeterminant);
+
+	//   ġ     
+	return Matrix4x4(
+		Vector4(_mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3))),
+		Vector4(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2))),
+		Vector4(_mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3))),
+		Vector4(_mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)))
+	);
+#else
+	// μ . aRC R C 
+	float a00 = Cols[0].X, a01 = Cols[1].X, a02 = Cols[2].X, a03 = Cols[3].X;
+	float a10 = Cols[0].Y, a11 = Cols[1].Y, a12 = Cols[2].Y, a13 = Cols[3].Y;
+	float a20 = Cols[0].Z, a21 = Cols[1].Z, a22 = Cols[2].Z, a23 = Cols[3].Z;
+	float a30 = Cols[0].W, a31 = Cols[1].W, a32 = Cols[2].W, a33 = Cols[3].W;
+
+	float s0 = a00 * a11 - a10 * a01;
+	float s1 = a00 * a12 - a10 * a02;
+	float s2 = a00 * a13 - a10 * a03;
+	float s3 = a01 * a12 - a11 * a02;
+	float s4 = a01 * a13 - a11 * a03;
+	float s5 = a02 * a13 - a12 * a03;
+	float c5 = a22 * a33 - a32 * a23;
+	float c4 = a21 * a33 - a31 * a23;
+	float c3 = a21 * a32 - a31 * a22;
+	float c2 = a20 * a33 - a30 * a23;
+	float c1 = a20 * a32 - a30 * a22;
+	float c0 = a20 * a31 - a30 * a21;
+
+	float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	if (determinant == 0.f)
+	{
+		return Matrix4x4::Identity;
+	}
+
+	float invDeterminant = 1.f / determinant;
+	return Matrix4x4(
+		Vector4(a11 * c5 - a12 * c4 + a13 * c3, -a10 * c5 + a12 * c2 - a13 * c1, a10 * c4 - a11 * c2 + a13 * c0, -a10 * c3 + a11 * c1 - a12 * c0) * invDeterminant,
+		Vector4(-a01 * c5 + a02 * c4 - a03 * c3, a00 * c5 - a02 * c2 + a03 * c1, -a00 * c4 + a01 * c2 - a03 * c0, a00 * c3 - a01 * c1 + a02 * c0) * invDeterminant,
+		Vector4(a31 * s5 - a32 * s4 + a33 * s3, -a30 * s5 + a32 * s2 - a33 * s1, a30 * s4 - a31 * s2 + a33 * s0, -a30 * s3 + a31 * s1 - a32 * s0) * invDeterminant,
+		Vector4(-a21 * s5 + a22 * s4 - a23 * s3, a20 * s5 - a22 * s2 + a23 * s1, -a20 * s4 + a21 * s2 - a23 * s0, a20 * s3 - a21 * s1 + a22 * s0) * invDeterminant
+	);
+#endif
+}
+
+FORCEINLINE Matrix4x4 Matrix4x4::InverseRigid() const
+{
+#if defined(MATH_SIMD_SSE2)
+	return InverseAffine(Cols[0].ToRegister(), Cols[1].ToRegister(), Cols[2].ToRegister(), Cols[3].ToRegister(), true);
+#else
+	// ȸ ġ, ̵ ġ ȸ ǵ
+	Vector3 translation = Cols[3].ToVector3();
+	Vector3 row0 = Cols[0].ToVector3();
+	Vector3 row1 = Cols[1].ToVector3();
+	Vector3 row2 = Cols[2].ToVector3();
+	return Matrix4x4(
+		Vector4(Cols[0].X, Cols[1].X, Cols[2].X, 0.f),
+		Vector4(Cols[0].Y, Cols[1].Y, Cols[2].Y, 0.f),
+		Vector4(Cols[0].Z, Cols[1].Z, Cols[2].Z, 0.f),
+		Vector4(-row0.Dot(translation), -row1.Dot(translation), -row2.Dot(translation), 1.f)
+	);
+#endif
+}
+
+FORCEINLINE Matrix4x4 Matrix4x4::InverseAffine() const
+{
+#if defined(MATH_SIMD_SSE2)
+	return InverseAffine(Cols[0].ToRegister(), Cols[1].ToRegister(), Cols[2].ToRegister(), Cols[3].ToRegister(), false);
+#else
+	// 3x3     Ľ  
+	Vector3 col0 = Cols[0].ToVector3();
+	Vector3 col1 = Cols[1].ToVector3();
+	Vector3 col2 = Cols[2].ToVector3();
+	Vector3 row0 = col1.Cross(col2);
+	Vector3 row1 = col2.Cross(col0);
+	Vector3 row2 = col0.Cross(col1);
+	float determinant = col0.Dot(row0);
+	if (determinant == 0.f)
+	{
+		return Matrix4x4::Identity;
+	}
+
+	float invDeterminant = 1.f / determinant;
+	row0 *= invDeterminant;
+	row1 *= invDeterminant;
+	row2 *= invDeterminant;
+	Vector3 translation = Cols[3].ToVector3();
+	return Matrix4x4(
+		Vector4(row0.X, row1.X, row2.X, 0.f),
+		Vector4(row0.Y, row1.Y, row2.Y, 0.f),
+		Vector4(row0.Z, row1.Z, row2.Z, 0.f),
+		Vector4(-row0.Dot(translation), -row1.Dot(translation), -row2.Dot(translation), 1.f)
+	);
+#endif
+}
+
+FORCEINLINE Matrix4x4 Matrix4x4::InverseOrthographic() const
+{
+	float invX = 1.f / Cols[0].X;
+	float invY = 1.f / Cols[1].Y;
+	float invZ = 1.f / Cols[2].Z;
+	return Matrix4x4(
+		Vector4(invX, 0.f, 0.f, 0.f),
+		Vector4(0.f, invY, 0.f, 0.f),
+		Vector4(0.f, 0.f, invZ, 0.f),
+		Vector4(-Cols[3].X * invX, -Cols[3].Y * invY, -Cols[3].Z * invZ, 1.f)
+	);
+}
+
+FORCEINLINE Matrix4x4 Matrix4x4::InversePerspective() const
+{
+	// x' = ax + kz, y' = by + lz, z' = cz + dw, w' = ez  Ųٷ Ǯ 
+	float invA = 1.f / Cols[0].X;
+	float invB = 1.f / Cols[1].Y;
+	float invD = 1.f / Cols[3].Z;
+	float invE = 1.f / Cols[2].W;
+	return Matrix4x4(
+		Vector4(invA, 0.f, 0.f, 0.f),
+		Vector4(0.f, invB, 0.f, 0.f),
+		Vector4(0.f, 0.f, 0.f, invD),
+		Vector4(-Cols[2].X * invA * invE, -Cols[2].Y * invB * invE, invE, -Cols[2].Z * invD * invE)
+	);
+}
+
+#if defined(MATH_SIMD_SSE2)
+FORCEINLINE __m128 Matrix4x4::Multiply2x2(__m128 InA, __m128 InB)
+{
+	return _mm_add_ps(
+		_mm_mul_ps(InA, _mm_shuffle_ps(InB, InB, _MM_SHUFFLE(3, 0, 3, 0))),
+		_mm_mul_ps(_mm_shuffle_ps(InA, InA, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(InB, InB, _MM_SHUFFLE(1, 2, 1, 2)))
+	);
+}
+
+// A#B
+FORCEINLINE __m128 Matrix4x4::AdjugateMultiply2x2(__m128 InA, __m128 InB)
+{
+	return _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(InA, InA, _MM_SHUFFLE(0, 0, 3, 3)), InB),
+		_mm_mul_ps(_mm_shuffle_ps(InA, InA, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(InB, InB, _MM_SHUFFLE(1, 0, 3, 2)))
+	);
+}
+
+// AB#
+FORCEINLINE __m128 Matrix4x4::MultiplyAdjugate2x2(__m128 InA, __m128 InB)
+{
+	return _mm_sub_ps(
+		_mm_mul_ps(InA, _mm_shuffle_ps(InB, InB, _MM_SHUFFLE(0, 3, 0, 3))),
+		_mm_mul_ps(_mm_shuffle_ps(InA, InA, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(InB, InB, _MM_SHUFFLE(1, 2, 1, 2)))
+	);
+}
+
+FORCEINLINE __m128 Matrix4x4::Cross(__m128 InA, __m128 InB)
+{
+	__m128 a = _mm_shuffle_ps(InA, InA, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 b = _mm_shuffle_ps(InB, InB, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 result = _mm_sub_ps(_mm_mul_ps(InA, b), _mm_mul_ps(a, InB));
+	return _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+FORCEINLINE Matrix4x4 Matrix4x4::InverseAffine(__m128 InCol0, __m128 InCol1, __m128 InCol2, __m128 InCol3, bool InIsRigid)
+{
+	__m128 row0, row1, row2;
+	if (InIsRigid)
+	{
+		row0 = InCol0;
+		row1 = InCol1;
+		row2 = InCol2;
+	}
+	else
+	{
+		row0 = Cross(InCol1, InCol2);
+		row1 = Cross(InCol2, InCol0);
+		row2 = Cross(InCol0, InCol1);
+		__m128 determinant = _mm_mul_ps(InCol0, row0);
+		determinant = _mm_add_ss(_mm_add_ss(determinant, _mm_shuffle_ps(determinant, determinant, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(determinant, determinant));
+		if (_mm_cvtss_f32(determinant) == 0.f)
+		{
+			return Matrix4x4::Identity;
+		}
+
+		__m128 invDeterminant = _mm_div_ps(_mm_set1_ps(1.f), _mm_shuffle_ps(determinant, determinant, _MM_SHUFFLE(0, 0, 0, 0)));
+		row0 = _mm_mul_ps(row0, invDeterminant);
+		row1 = _mm_mul_ps(row1, invDeterminant);
+		row2 = _mm_mul_ps(row2, invDeterminant);
+	}
 
-	return v4.ToVector3();
+	//  ġ   W  0 
+	__m128 zero = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(row0, row1, row2, zero);
+	__m128 translation = _mm_mul_ps(row0, _mm_shuffle_ps(InCol3, InCol3, _MM_SHUFFLE(0, 0, 0, 0)));
+	translation = _mm_add_ps(translation, _mm_mul_ps(row1, _mm_shuffle_ps(InCol3, InCol3, _MM_SHUFFLE(1, 1, 1, 1))));
+	translation = _mm_add_ps(translation, _mm_mul_ps(row2, _mm_shuffle_ps(InCol3, InCol3, _MM_SHUFFLE(2, 2, 2, 2))));
+	translation = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), translation);
+	return Matrix4x4(Vector4(row0), Vector4(row1), Vector4(row2), Vector4(translation));
 }
+#endif
 
 }
\ No newline at end of file
@@ -10,3 +10,24 @@
 #define FORCEINLINE inline
 #endif
 
+#if !defined(ALIGNED_MALLOC)
+#include <stdlib.h>
+#define ALIGNED_MALLOC(InSize, InAlignment) aligned_alloc((InAlignment), (((InSize) + (InAlignment) - 1) / (InAlignment)) * (InAlignment))
+#define ALIGNED_FREE(InPointer) free(InPointer)
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PLATFORM_SIMD_SSE2 1
+#endif
+
+#if defined(__AVX2__)
+#define PLATFORM_SIMD_AVX2 1
+#endif
+
+// Math types use SIMD registers when available. Define MATH_NO_SIMD to build the scalar fallback.
+#if defined(PLATFORM_SIMD_SSE2) && !defined(MATH_NO_SIMD)
+#define MATH_SIMD_SSE2 1
+#if defined(PLATFORM_SIMD_AVX2)
+#define MATH_SIMD_AVX2 1
+#endif
+#endif
@@ -0,0 +1,220 @@
+#pragma once
+
+namespace CK
+{
+
+// Unit quaternion rotation. Angles are in degrees like Math::GetSinCos.
+// A * B rotates by B first and then by A, the same order as the matching rotation matrices.
+struct Quaternion
+{
+public:
+	FORCEINLINE constexpr Quaternion() = default;
+	FORCEINLINE constexpr explicit Quaternion(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) { }
+	// The axis has to be normalized.
+	FORCEINLINE explicit Quaternion(const Vector3& InAxis, float InAngleDegree);
+	// Rotation part of an orthonormal matrix without reflection.
+	FORCEINLINE explicit Quaternion(const Matrix3x3& InMatrix);
+
+	FORCEINLINE constexpr Quaternion operator-() const;
+	FORCEINLINE constexpr Quaternion operator*(float InScale) const;
+	FORCEINLINE constexpr Quaternion operator+(const Quaternion& InQuaternion) const;
+	FORCEINLINE constexpr Quaternion operator*(const Quaternion& InQuaternion) const;
+	FORCEINLINE Quaternion& operator*=(const Quaternion& InQuaternion);
+
+	FORCEINLINE constexpr float SizeSquared() const;
+	FORCEINLINE constexpr float Dot(const Quaternion& InQuaternion) const;
+	FORCEINLINE Quaternion Normalize() const;
+	FORCEINLINE constexpr Quaternion Conjugate() const;
+	// Same as Conjugate for unit quaternions.
+	FORCEINLINE Quaternion Inverse() const;
+	FORCEINLINE constexpr Vector3 RotateVector(const Vector3& InVector) const;
+	FORCEINLINE constexpr Matrix3x3 ToRotationMatrix() const;
+	FORCEINLINE bool EqualsInTolerance(const Quaternion& InQuaternion, float InTolerance = KINDA_SMALL_NUMBER) const;
+
+	// Shortest path interpolation. Falls back to a normalized lerp when the rotations are nearly the same.
+	static FORCEINLINE Quaternion Slerp(const Quaternion& InFrom, const Quaternion& InTo, float InAlpha);
+
+	std::string ToString() const;
+
+	static const Quaternion Identity;
+
+	float X = 0.f;
+	float Y = 0.f;
+	float Z = 0.f;
+	float W = 1.f;
+};
+
+inline constexpr Quaternion Quaternion::Identity(0.f, 0.f, 0.f, 1.f);
+
+FORCEINLINE Quaternion::Quaternion(const Vector3& InAxis, float InAngleDegree)
+{
+	float sin = 0.f, cos = 0.f;
+	Math::GetSinCos(sin, cos, InAngleDegree * 0.5f);
+	X = InAxis.X * sin;
+	Y = InAxis.Y * sin;
+	Z = InAxis.Z * sin;
+	W = cos;
+}
+
+FORCEINLINE Quaternion::Quaternion(const Matrix3x3& InMatrix)
+{
+	// Starts from the largest of the four components to stay away from dividing by a small root.
+	const Vector3& c0 = InMatrix[0];
+	const Vector3& c1 = InMatrix[1];
+	const Vector3& c2 = InMatrix[2];
+	float trace = c0.X + c1.Y + c2.Z;
+	if (trace > 0.f)
+	{
+		float root = sqrtf(trace + 1.f);
+		float scale = 0.5f / root;
+		W = 0.5f * root;
+		X = (c1.Z - c2.Y) * scale;
+		Y = (c2.X - c0.Z) * scale;
+		Z = (c0.Y - c1.X) * scale;
+	}
+	else if (c0.X >= c1.Y && c0.X >= c2.Z)
+	{
+		float root = sqrtf(1.f + c0.X - c1.Y - c2.Z);
+		float scale = 0.5f / root;
+		X = 0.5f * root;
+		Y = (c0.Y + c1.X) * scale;
+		Z = (c2.X + c0.Z) * scale;
+		W = (c1.Z - c2.Y) * scale;
+	}
+	else if (c1.Y >= c2.Z)
+	{
+		float root = sqrtf(1.f + c1.Y - c0.X - c2.Z);
+		float scale = 0.5f / root;
+		Y = 0.5f * root;
+		X = (c0.Y + c1.X) * scale;
+		Z = (c1.Z + c2.Y) * scale;
+		W = (c2.X - c0.Z) * scale;
+	}
+	else
+	{
+		float root = sqrtf(1.f + c2.Z - c0.X - c1.Y);
+		float scale = 0.5f / root;
+		Z = 0.5f * root;
+		X = (c2.X + c0.Z) * scale;
+		Y = (c1.Z + c2.Y) * scale;
+		W = (c0.Y - c1.X) * scale;
+	}
+}
+
+FORCEINLINE constexpr Quaternion Quaternion::operator-() const
+{
+	return Quaternion(-X, -Y, -Z, -W);
+}
+
+FORCEINLINE constexpr Quaternion Quaternion::operator*(float InScale) const
+{
+	return Quaternion(X * InScale, Y * InScale, Z * InScale, W * InScale);
+}
+
+FORCEINLINE constexpr Quaternion Quaternion::operator+(const Quaternion& InQuaternion) const
+{
+	return Quaternion(X + InQuaternion.X, Y + InQuaternion.Y, Z + InQuaternion.Z, W + InQuaternion.W);
+}
+
+FORCEINLINE constexpr Quaternion Quaternion::operator*(const Quaternion& InQuaternion) const
+{
+	const Quaternion& q = InQuaternion;
+	return Quaternion(
+		W * q.X + X * q.W + Y * q.Z - Z * q.Y,
+		W * q.Y - X * q.Z + Y * q.W + Z * q.X,
+		W * q.Z + X * q.Y - Y * q.X + Z * q.W,
+		W * q.W - X * q.X - Y * q.Y - Z * q.Z
+	);
+}
+
+FORCEINLINE Quaternion& Quaternion::operator*=(const Quaternion& InQuaternion)
+{
+	*this = *this * InQuaternion;
+	return *this;
+}
+
+FORCEINLINE constexpr float Quaternion::SizeSquared() const
+{
+	return X * X + Y * Y + Z * Z + W * W;
+}
+
+FORCEINLINE constexpr float Quaternion::Dot(const Quaternion& InQuaternion) const
+{
+	return X * InQuaternion.X + Y * InQuaternion.Y + Z * InQuaternion.Z + W * InQuaternion.W;
+}
+
+FORCEINLINE Quaternion Quaternion::Normalize() const
+{
+	float squareSum = SizeSquared();
+	if (squareSum == 0.f)
+	{
+		return Quaternion::Identity;
+	}
+
+	return *this * Math::InvSqrt(squareSum);
+}
+
+FORCEINLINE constexpr Quaternion Quaternion::Conjugate() const
+{
+	return Quaternion(-X, -Y, -Z, W);
+}
+
+FORCEINLINE Quaternion Quaternion::Inverse() const
+{
+	float squareSum = SizeSquared();
+	if (squareSum == 0.f)
+	{
+		return Quaternion::Identity;
+	}
+
+	return Conjugate() * (1.f / squareSum);
+}
+
+FORCEINLINE constexpr Vector3 Quaternion::RotateVector(const Vector3& InVector) const
+{
+	// v + 2w(q x v) + 2q x (q x v)
+	Vector3 axis(X, Y, Z);
+	Vector3 t = axis.Cross(InVector) * 2.f;
+	return InVector + t * W + axis.Cross(t);
+}
+
+FORCEINLINE constexpr Matrix3x3 Quaternion::ToRotationMatrix() const
+{
+	float x2 = X + X, y2 = Y + Y, z2 = Z + Z;
+	float xx = X * x2, yy = Y * y2, zz = Z * z2;
+	float xy = X * y2, xz = X * z2, yz = Y * z2;
+	float wx = W * x2, wy = W * y2, wz = W * z2;
+	return Matrix3x3(
+		Vector3(1.f - (yy + zz), xy + wz, xz - wy),
+		Vector3(xy - wz, 1.f - (xx + zz), yz + wx),
+		Vector3(xz + wy, yz - wx, 1.f - (xx + yy))
+	);
+}
+
+FORCEINLINE bool Quaternion::EqualsInTolerance(const Quaternion& InQuaternion, float InTolerance) const
+{
+	// q and -q are the same rotation.
+	return Math::Abs(Dot(InQuaternion)) >= 1.f - InTolerance;
+}
+
+FORCEINLINE Quaternion Quaternion::Slerp(const Quaternion& InFrom, const Quaternion& InTo, float InAlpha)
+{
+	float cos = InFrom.Dot(InTo);
+	Quaternion to = InTo;
+	if (cos < 0.f)
+	{
+		cos = -cos;
+		to = -InTo;
+	}
+
+	if (cos > 1.f - KINDA_SMALL_NUMBER)
+	{
+		return (InFrom * (1.f - InAlpha) + to * InAlpha).Normalize();
+	}
+
+	float angle = acosf(cos);
+	float invSin = 1.f / sinf(angle);
+	return InFrom * (sinf((1.f - InAlpha) * angle) * invSin) + to * (sinf(InAlpha * angle) * invSin);
+}
+
+}
@@ -6,13 +6,13 @@ namespace CK
 struct ScreenPoint
 {
 public:
-	FORCEINLINE ScreenPoint() = default;
-	FORCEINLINE explicit ScreenPoint(int InX, int InY) : X(InX), Y(InY) { }
+	FORCEINLINE constexpr ScreenPoint() = default;
+	FORCEINLINE constexpr explicit ScreenPoint(int InX, int InY) : X(InX), Y(InY) { }
 	FORCEINLINE explicit ScreenPoint(float InX, float InY) : X(Math::FloorToInt(InX)), Y(Math::FloorToInt(InY)) { }
 	FORCEINLINE explicit ScreenPoint(const Vector2& InPos) : ScreenPoint(InPos.X, InPos.Y) {}
 
 	ScreenPoint GetHalf() { return ScreenPoint(Math::FloorToInt(0.5f * X), Math::FloorToInt(0.5f * Y)); }
-	FORCEINLINE bool HasZero() const { return ( X == 0 || Y == 0 ); }
+	FORCEINLINE constexpr bool HasZero() const { return ( X == 0 || Y == 0 ); }
 
 	FORCEINLINE static ScreenPoint ToScreenCoordinate(const ScreenPoint& InScreenSize, const Vector2& InPos)
 	{
@@ -24,19 +24,19 @@ public:
 		return Vector2(X - InScreenSize.X * 0.5f + 0.5f, -Y + InScreenSize.Y * 0.5f + 0.5f);
 	}
 
-	FORCEINLINE ScreenPoint operator-(const ScreenPoint& InPoint) const;
-	FORCEINLINE ScreenPoint operator+(const ScreenPoint& InPoint) const;
+	FORCEINLINE constexpr ScreenPoint operator-(const ScreenPoint& InPoint) const;
+	FORCEINLINE constexpr ScreenPoint operator+(const ScreenPoint& InPoint) const;
 
 	int X = 0;
 	int Y = 0;
 };
 
-FORCEINLINE ScreenPoint ScreenPoint::operator-(const ScreenPoint& InPoint) const
+FORCEINLINE constexpr ScreenPoint ScreenPoint::operator-(const ScreenPoint& InPoint) const
 {
 	return ScreenPoint(X - InPoint.X, Y - InPoint.Y);
 }
 
-FORCEINLINE ScreenPoint ScreenPoint::operator+(const ScreenPoint& InPoint) const
+FORCEINLINE constexpr ScreenPoint ScreenPoint::operator+(const ScreenPoint& InPoint) const
 {
 	return ScreenPoint(X + InPoint.X, Y + InPoint.Y);
 }
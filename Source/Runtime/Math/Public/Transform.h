@@ -0,0 +1,67 @@
+#pragma once
+
+namespace CK
+{
+
+// Position, rotation and scale applied to points in the order scale, rotation, translation.
+struct Transform
+{
+public:
+	FORCEINLINE constexpr Transform() = default;
+	FORCEINLINE constexpr explicit Transform(const Vector3& InPosition, const Quaternion& InRotation = Quaternion::Identity, const Vector3& InScale = Vector3::One)
+		: Position(InPosition), Rotation(InRotation), Scale(InScale) { }
+	// Splits an affine matrix without shear. A reflection ends up as a negative X scale.
+	FORCEINLINE explicit Transform(const Matrix4x4& InMatrix);
+
+	FORCEINLINE constexpr Matrix4x4 GetMatrix() const;
+	FORCEINLINE constexpr Vector3 TransformPoint(const Vector3& InPoint) const;
+
+	std::string ToString() const;
+
+	static const Transform Identity;
+
+	Vector3 Position;
+	Quaternion Rotation;
+	Vector3 Scale = Vector3::One;
+};
+
+inline constexpr Transform Transform::Identity;
+
+FORCEINLINE Transform::Transform(const Matrix4x4& InMatrix)
+{
+	Vector3 axisX = InMatrix[0].ToVector3();
+	Vector3 axisY = InMatrix[1].ToVector3();
+	Vector3 axisZ = InMatrix[2].ToVector3();
+	Position = InMatrix[3].ToVector3();
+	Scale = Vector3(axisX.Size(), axisY.Size(), axisZ.Size());
+	if (axisX.Dot(axisY.Cross(axisZ)) < 0.f)
+	{
+		Scale.X = -Scale.X;
+	}
+
+	if (Scale.X == 0.f || Scale.Y == 0.f || Scale.Z == 0.f)
+	{
+		Rotation = Quaternion::Identity;
+		return;
+	}
+
+	Rotation = Quaternion(Matrix3x3(axisX / Scale.X, axisY / Scale.Y, axisZ / Scale.Z)).Normalize();
+}
+
+FORCEINLINE constexpr Matrix4x4 Transform::GetMatrix() const
+{
+	Matrix3x3 rotation = Rotation.ToRotationMatrix();
+	return Matrix4x4(
+		Vector4(rotation[0] * Scale.X, false),
+		Vector4(rotation[1] * Scale.Y, false),
+		Vector4(rotation[2] * Scale.Z, false),
+		Vector4(Position, true)
+	);
+}
+
+FORCEINLINE constexpr Vector3 Transform::TransformPoint(const Vector3& InPoint) const
+{
+	return Rotation.RotateVector(Vector3(InPoint.X * Scale.X, InPoint.Y * Scale.Y, InPoint.Z * Scale.Z)) + Position;
+}
+
+}
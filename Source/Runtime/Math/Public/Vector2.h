@@ -7,30 +7,31 @@ struct Vector2
 {
 public:
 	//  
-	FORCEINLINE Vector2() = default;
-	FORCEINLINE explicit Vector2(int InX, int InY) : X((float)InX), Y((float)InY) { }
-	FORCEINLINE explicit Vector2(float InX, float InY) : X(InX), Y(InY) { }
+	FORCEINLINE constexpr Vector2() = default;
+	FORCEINLINE constexpr explicit Vector2(int InX, int InY) : X((float)InX), Y((float)InY) { }
+	FORCEINLINE constexpr explicit Vector2(float InX, float InY) : X(InX), Y(InY) { }
 
 	//  
 	FORCEINLINE float operator[](BYTE InIndex) const;
 	FORCEINLINE float& operator[](BYTE InIndex);
-	FORCEINLINE Vector2 operator-() const;
-	FORCEINLINE Vector2 operator*(float InScalar) const;
-	FORCEINLINE Vector2 operator/(float InScalar) const;
-	FORCEINLINE Vector2 operator+(const Vector2& InVector) const;
-	FORCEINLINE Vector2 operator-(const Vector2& InVector) const;
-	FORCEINLINE Vector2& operator*=(float InScale);
-	FORCEINLINE Vector2& operator/=(float InScale);
-	FORCEINLINE Vector2& operator+=(const Vector2& InVector);
-	FORCEINLINE Vector2& operator-=(const Vector2& InVector);
+	FORCEINLINE constexpr Vector2 operator-() const;
+	FORCEINLINE constexpr Vector2 operator*(float InScalar) const;
+	FORCEINLINE constexpr Vector2 operator/(float InScalar) const;
+	FORCEINLINE constexpr Vector2 operator+(const Vector2& InVector) const;
+	FORCEINLINE constexpr Vector2 operator-(const Vector2& InVector) const;
+	FORCEINLINE constexpr Vector2& operator*=(float InScale);
+	FORCEINLINE constexpr Vector2& operator/=(float InScale);
+	FORCEINLINE constexpr Vector2& operator+=(const Vector2& InVector);
+	FORCEINLINE constexpr Vector2& operator-=(const Vector2& InVector);
 
 	// Լ 
 	FORCEINLINE float Size() const;
-	FORCEINLINE float SizeSquared() const;
+	FORCEINLINE constexpr float SizeSquared() const;
 	FORCEINLINE Vector2 Normalize() const;
+	FORCEINLINE Vector2 FastNormalize() const;
 	FORCEINLINE bool EqualsInTolerance(const Vector2& InVector, float InTolerance = KINDA_SMALL_NUMBER) const;
 	FORCEINLINE float Max() const;
-	FORCEINLINE float Dot(const Vector2& InVector) const;
+	FORCEINLINE constexpr float Dot(const Vector2& InVector) const;
 
 	std::string ToString() const;
 
@@ -47,12 +48,19 @@ public:
 	float Y = 0.f;
 };
 
+inline constexpr Vector2 Vector2::UnitX(1.f, 0.f);
+inline constexpr Vector2 Vector2::UnitY(0.f, 1.f);
+inline constexpr Vector2 Vector2::Zero(0.f, 0.f);
+inline constexpr Vector2 Vector2::One(1.f, 1.f);
+inline constexpr Vector2 Vector2::Infinity(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
+inline constexpr Vector2 Vector2::InfinityNeg(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
+
 FORCEINLINE float Vector2::Size() const
 {
 	return sqrtf(SizeSquared());
 }
 
-FORCEINLINE float Vector2::SizeSquared() const
+FORCEINLINE constexpr float Vector2::SizeSquared() const
 {
 	return X * X + Y * Y;
 }
@@ -73,6 +81,18 @@ FORCEINLINE Vector2 Vector2::Normalize() const
 	return Vector2(X * invLength, Y * invLength);
 }
 
+FORCEINLINE Vector2 Vector2::FastNormalize() const
+{
+	float squareSum = SizeSquared();
+	if (squareSum == 0.f)
+	{
+		return Vector2::Zero;
+	}
+
+	float invLength = Math::FastInvSqrt(squareSum);
+	return Vector2(X * invLength, Y * invLength);
+}
+
 FORCEINLINE float Vector2::operator[](BYTE InIndex) const
 {
 	if (InIndex < 0 || InIndex > 1) InIndex = 0;
@@ -85,53 +105,53 @@ FORCEINLINE float &Vector2::operator[](BYTE InIndex)
 	return ((float *)this)[InIndex];
 }
 
-FORCEINLINE Vector2 Vector2::operator-() const
+FORCEINLINE constexpr Vector2 Vector2::operator-() const
 {
 	return Vector2(-X, -Y);
 }
 
-FORCEINLINE Vector2 Vector2::operator*(float InScalar) const
+FORCEINLINE constexpr Vector2 Vector2::operator*(float InScalar) const
 {
 	return Vector2(X * InScalar, Y * InScalar);
 }
 
-FORCEINLINE Vector2 Vector2::operator/(float InScalar) const
+FORCEINLINE constexpr Vector2 Vector2::operator/(float InScalar) const
 {
 	return Vector2(X / InScalar, Y / InScalar);
 }
 
-FORCEINLINE Vector2 Vector2::operator+(const Vector2& InVector) const
+FORCEINLINE constexpr Vector2 Vector2::operator+(const Vector2& InVector) const
 {
 	return Vector2(X + InVector.X, Y + InVector.Y);
 }
 
-FORCEINLINE Vector2 Vector2::operator-(const Vector2& InVector) const
+FORCEINLINE constexpr Vector2 Vector2::operator-(const Vector2& InVector) const
 {
 	return Vector2(X - InVector.X, Y - InVector.Y);
 }
 
-FORCEINLINE Vector2& Vector2::operator*=(float InScale)
+FORCEINLINE constexpr Vector2& Vector2::operator*=(float InScale)
 {
 	X *= InScale;
 	Y *= InScale;
 	return *this;
 }
 
-FORCEINLINE Vector2& Vector2::operator/=(float InScale)
+FORCEINLINE constexpr Vector2& Vector2::operator/=(float InScale)
 {
 	X /= InScale;
 	Y /= InScale;
 	return *this;
 }
 
-FORCEINLINE Vector2& Vector2::operator+=(const Vector2& InVector)
+FORCEINLINE constexpr Vector2& Vector2::operator+=(const Vector2& InVector)
 {
 	X += InVector.X;
 	Y += InVector.Y;
 	return *this;
 }
 
-FORCEINLINE Vector2& Vector2::operator-=(const Vector2& InVector)
+FORCEINLINE constexpr Vector2& Vector2::operator-=(const Vector2& InVector)
 {
 	X -= InVector.X;
 	Y -= InVector.Y;
@@ -149,7 +169,7 @@ FORCEINLINE float Vector2::Max() const
 	return Math::Max(X, Y);
 }
 
-FORCEINLINE float Vector2::Dot(const Vector2& InVector) const
+FORCEINLINE constexpr float Vector2::Dot(const Vector2& InVector) const
 {
 	return X * InVector.X + Y * InVector.Y;
 }
@@ -7,32 +7,33 @@ struct Vector3
 {
 public:
 	//  
-	FORCEINLINE Vector3() = default;
-	FORCEINLINE explicit Vector3(const Vector2& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y) { Z = IsPoint ? 1.f : 0.f; }
-	FORCEINLINE explicit Vector3(float InX, float InY, float InZ) : X(InX), Y(InY), Z(InZ) { }
+	FORCEINLINE constexpr Vector3() = default;
+	FORCEINLINE constexpr explicit Vector3(const Vector2& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y), Z(IsPoint ? 1.f : 0.f) { }
+	FORCEINLINE constexpr explicit Vector3(float InX, float InY, float InZ) : X(InX), Y(InY), Z(InZ) { }
 
 	//  
 	FORCEINLINE float operator[](BYTE InIndex) const;
 	FORCEINLINE float& operator[](BYTE InIndex);
-	FORCEINLINE Vector3 operator-() const;
-	FORCEINLINE Vector3 operator*(float InScale) const;
-	FORCEINLINE Vector3 operator/(float InScale) const;
-	FORCEINLINE Vector3 operator+(const Vector3& InVector) const;
-	FORCEINLINE Vector3 operator-(const Vector3& InVector) const;
-	FORCEINLINE Vector3& operator*=(float InScale);
-	FORCEINLINE Vector3& operator/=(float InScale);
-	FORCEINLINE Vector3& operator+=(const Vector3& InVector);
-	FORCEINLINE Vector3& operator-=(const Vector3& InVector);
+	FORCEINLINE constexpr Vector3 operator-() const;
+	FORCEINLINE constexpr Vector3 operator*(float InScale) const;
+	FORCEINLINE constexpr Vector3 operator/(float InScale) const;
+	FORCEINLINE constexpr Vector3 operator+(const Vector3& InVector) const;
+	FORCEINLINE constexpr Vector3 operator-(const Vector3& InVector) const;
+	FORCEINLINE constexpr Vector3& operator*=(float InScale);
+	FORCEINLINE constexpr Vector3& operator/=(float InScale);
+	FORCEINLINE constexpr Vector3& operator+=(const Vector3& InVector);
+	FORCEINLINE constexpr Vector3& operator-=(const Vector3& InVector);
 
 	// Լ 
-	FORCEINLINE Vector2 ToVector2() const;
+	FORCEINLINE constexpr Vector2 ToVector2() const;
 	FORCEINLINE float Size() const;
-	FORCEINLINE float SizeSquared() const;
+	FORCEINLINE constexpr float SizeSquared() const;
 	FORCEINLINE Vector3 Normalize() const;
+	FORCEINLINE Vector3 FastNormalize() const;
 	FORCEINLINE bool EqualsInTolerance(const Vector3& InVector, float InTolerance = KINDA_SMALL_NUMBER) const;
 	FORCEINLINE float Max() const;
-	FORCEINLINE float Dot(const Vector3& InVector) const;
-	FORCEINLINE Vector3 Cross(const Vector3& InVector) const;
+	FORCEINLINE constexpr float Dot(const Vector3& InVector) const;
+	FORCEINLINE constexpr Vector3 Cross(const Vector3& InVector) const;
 
 	//  
 	static const Vector3 UnitX;
@@ -51,7 +52,15 @@ public:
 	float Z = 0.f;
 };
 
-FORCEINLINE Vector2 Vector3::ToVector2() const
+inline constexpr Vector3 Vector3::UnitX(1.f, 0.f, 0.f);
+inline constexpr Vector3 Vector3::UnitY(0.f, 1.f, 0.f);
+inline constexpr Vector3 Vector3::UnitZ(0.f, 0.f, 1.f);
+inline constexpr Vector3 Vector3::Zero(0.f, 0.f, 0.f);
+inline constexpr Vector3 Vector3::One(1.f, 1.f, 1.f);
+inline constexpr Vector3 Vector3::Infinity(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
+inline constexpr Vector3 Vector3::InfinityNeg(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
+
+FORCEINLINE constexpr Vector2 Vector3::ToVector2() const
 {
 	return Vector2(X, Y);
 }
@@ -61,7 +70,7 @@ FORCEINLINE float Vector3::Size() const
 	return sqrtf(SizeSquared());
 }
 
-FORCEINLINE float Vector3::SizeSquared() const
+FORCEINLINE constexpr float Vector3::SizeSquared() const
 {
 	return X * X + Y * Y + Z * Z;
 }
@@ -82,6 +91,18 @@ FORCEINLINE Vector3 Vector3::Normalize() const
 	return Vector3(X * invLength, Y * invLength, Z * invLength);
 }
 
+FORCEINLINE Vector3 Vector3::FastNormalize() const
+{
+	float squareSum = SizeSquared();
+	if (squareSum == 0.f)
+	{
+		return Vector3::Zero;
+	}
+
+	float invLength = Math::FastInvSqrt(squareSum);
+	return Vector3(X * invLength, Y * invLength, Z * invLength);
+}
+
 FORCEINLINE float Vector3::operator[](BYTE InIndex) const
 {
 	if (InIndex < 0 || InIndex > 2) InIndex = 0;
@@ -94,32 +115,32 @@ FORCEINLINE float &Vector3::operator[](BYTE InIndex)
 	return ((float *)this)[InIndex];
 }
 
-FORCEINLINE Vector3 Vector3::operator-() const
+FORCEINLINE constexpr Vector3 Vector3::operator-() const
 {
 	return Vector3(-X, -Y, -Z);
 }
 
-FORCEINLINE Vector3 Vector3::operator*(float InScale) const
+FORCEINLINE constexpr Vector3 Vector3::operator*(float InScale) const
 {
 	return Vector3(X * InScale, Y * InScale, Z * InScale);
 }
 
-FORCEINLINE Vector3 Vector3::operator/(float InScale) const
+FORCEINLINE constexpr Vector3 Vector3::operator/(float InScale) const
 {
 	return Vector3(X / InScale, Y / InScale, Z / InScale);
 }
 
-FORCEINLINE Vector3 Vector3::operator+(const Vector3& InVector) const
+FORCEINLINE constexpr Vector3 Vector3::operator+(const Vector3& InVector) const
 {
 	return Vector3(X + InVector.X, Y + InVector.Y, Z + InVector.Z);
 }
 
-FORCEINLINE Vector3 Vector3::operator-(const Vector3& InVector) const
+FORCEINLINE constexpr Vector3 Vector3::operator-(const Vector3& InVector) const
 {
 	return Vector3(X - InVector.X, Y - InVector.Y, Z - InVector.Z);
 }
 
-FORCEINLINE Vector3& Vector3::operator*=(float InScale)
+FORCEINLINE constexpr Vector3& Vector3::operator*=(float InScale)
 {
 	X *= InScale;
 	Y *= InScale;
@@ -127,7 +148,7 @@ FORCEINLINE Vector3& Vector3::operator*=(float InScale)
 	return *this;
 }
 
-FORCEINLINE Vector3& Vector3::operator/=(float InScale)
+FORCEINLINE constexpr Vector3& Vector3::operator/=(float InScale)
 {
 	X /= InScale;
 	Y /= InScale;
@@ -135,7 +156,7 @@ FORCEINLINE Vector3& Vector3::operator/=(float InScale)
 	return *this;
 }
 
-FORCEINLINE Vector3& Vector3::operator+=(const Vector3& InVector)
+FORCEINLINE constexpr Vector3& Vector3::operator+=(const Vector3& InVector)
 {
 	X += InVector.X;
 	Y += InVector.Y;
@@ -143,7 +164,7 @@ FORCEINLINE Vector3& Vector3::operator+=(const Vector3& InVector)
 	return *this;
 }
 
-FORCEINLINE Vector3& Vector3::operator-=(const Vector3& InVector)
+FORCEINLINE constexpr Vector3& Vector3::operator-=(const Vector3& InVector)
 {
 	X -= InVector.X;
 	Y -= InVector.Y;
@@ -164,12 +185,12 @@ FORCEINLINE float Vector3::Max() const
 	return Math::Max(max, Z);
 }
 
-FORCEINLINE float Vector3::Dot(const Vector3& InVector) const
+FORCEINLINE constexpr float Vector3::Dot(const Vector3& InVector) const
 {
 	return X * InVector.X + Y * InVector.Y + Z * InVector.Z;
 }
 
-FORCEINLINE Vector3 Vector3::Cross(const Vector3& InVector) const
+FORCEINLINE constexpr Vector3 Vector3::Cross(const Vector3& InVector) const
 {
 	return Vector3(
 		Y * InVector.Z - Z * InVector.Y,
@@ -3,15 +3,16 @@
 namespace CK
 {
 
-struct Vector4
+// SIMD   16Ʈ 
+struct alignas(16) Vector4
 {
 public:
 	//  
-	FORCEINLINE Vector4() = default;
-	FORCEINLINE explicit Vector4(const Vector2& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y), Z(0.f) { W = IsPoint ? 1.f : 0.f; }
-	FORCEINLINE explicit Vector4(const Vector3& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y), Z(InV.Z) { W = IsPoint ? 1.f : 0.f; }
-	FORCEINLINE explicit Vector4(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) { }
-	FORCEINLINE explicit Vector4(float InX, float InY, float InZ, bool IsPoint = true) : X(InX), Y(InY), Z(InZ) { W = IsPoint ? 1.f : 0.f; }
+	FORCEINLINE constexpr Vector4() = default;
+	FORCEINLINE constexpr explicit Vector4(const Vector2& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y), Z(0.f), W(IsPoint ? 1.f : 0.f) { }
+	FORCEINLINE constexpr explicit Vector4(const Vector3& InV, bool IsPoint = true) : X(InV.X), Y(InV.Y), Z(InV.Z), W(IsPoint ? 1.f : 0.f) { }
+	FORCEINLINE constexpr explicit Vector4(float InX, float InY, float InZ, float InW) : X(InX), Y(InY), Z(InZ), W(InW) { }
+	FORCEINLINE constexpr explicit Vector4(float InX, float InY, float InZ, bool IsPoint = true) : X(InX), Y(InY), Z(InZ), W(IsPoint ? 1.f : 0.f) { }
 
 	//  
 	FORCEINLINE float operator[](BYTE InIndex) const;
@@ -27,14 +28,15 @@ public:
 	FORCEINLINE Vector4& operator-=(const Vector4& InVector);
 
 	// Լ 
-	FORCEINLINE Vector2 ToVector2() const;
-	FORCEINLINE Vector3 ToVector3() const;
+	FORCEINLINE constexpr Vector2 ToVector2() const;
+	FORCEINLINE constexpr Vector3 ToVector3() const;
 	FORCEINLINE float Size() const;
-	FORCEINLINE float SizeSquared() const;
+	FORCEINLINE constexpr float SizeSquared() const;
 	FORCEINLINE Vector4 Normalize() const;
+	FORCEINLINE Vector4 FastNormalize() const;
 	FORCEINLINE bool EqualsInTolerance(const Vector4& InVector, float InTolerance = KINDA_SMALL_NUMBER) const;
 	FORCEINLINE float Max() const;
-	FORCEINLINE float Dot(const Vector4& InVector) const;
+	FORCEINLINE constexpr float Dot(const Vector4& InVector) const;
 
 	//  
 	static const Vector4 UnitX;
@@ -48,6 +50,11 @@ public:
 
 	std::string ToString() const;
 
+#if defined(MATH_SIMD_SSE2)
+	FORCEINLINE explicit Vector4(__m128 InRegister) { _mm_store_ps(&X, InRegister); }
+	FORCEINLINE __m128 ToRegister() const { return _mm_load_ps(&X); }
+#endif
+
 	//  
 	float X = 0.f;
 	float Y = 0.f;
@@ -55,12 +62,21 @@ public:
 	float W = 0.f;
 };
 
-FORCEINLINE Vector2 Vector4::ToVector2() const
+inline constexpr Vector4 Vector4::UnitX(1.f, 0.f, 0.f, 0.f);
+inline constexpr Vector4 Vector4::UnitY(0.f, 1.f, 0.f, 0.f);
+inline constexpr Vector4 Vector4::UnitZ(0.f, 0.f, 1.f, 0.f);
+inline constexpr Vector4 Vector4::UnitW(0.f, 0.f, 0.f, 1.f);
+inline constexpr Vector4 Vector4::Zero(0.f, 0.f, 0.f, 0.f);
+inline constexpr Vector4 Vector4::One(1.f, 1.f, 1.f, 1.f);
+inline constexpr Vector4 Vector4::Infinity(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
+inline constexpr Vector4 Vector4::InfinityNeg(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
+
+FORCEINLINE constexpr Vector2 Vector4::ToVector2() const
 {
 	return Vector2(X, Y);
 }
 
-FORCEINLINE Vector3 Vector4::ToVector3() const
+FORCEINLINE constexpr Vector3 Vector4::ToVector3() const
 {
 	return Vector3(X, Y, Z);
 }
@@ -70,7 +86,7 @@ FORCEINLINE float Vector4::Size() const
 	return sqrtf(SizeSquared());
 }
 
-FORCEINLINE float Vector4::SizeSquared() const
+FORCEINLINE constexpr float Vector4::SizeSquared() const
 {
 	return X * X + Y * Y + Z * Z + W * W;
 }
@@ -91,6 +107,18 @@ FORCEINLINE Vector4 Vector4::Normalize() const
 	return Vector4(X * invLength, Y * invLength, Z * invLength, W * invLength);
 }
 
+FORCEINLINE Vector4 Vector4::FastNormalize() const
+{
+	float squareSum = SizeSquared();
+	if (squareSum == 0.f)
+	{
+		return Vector4::Zero;
+	}
+
+	float invLength = Math::FastInvSqrt(squareSum);
+	return Vector4(X * invLength, Y * invLength, Z * invLength, W * invLength);
+}
+
 FORCEINLINE float Vector4::operator[](BYTE InIndex) const
 {
 	if (InIndex < 0 || InIndex > 3) InIndex = 0;
@@ -103,6 +131,56 @@ FORCEINLINE float& Vector4::operator[](BYTE InIndex)
 	return ((float *)this)[InIndex];
 }
 
+#if defined(MATH_SIMD_SSE2)
+FORCEINLINE Vector4 Vector4::operator-() const
+{
+	return Vector4(_mm_xor_ps(ToRegister(), _mm_set1_ps(-0.f)));
+}
+
+FORCEINLINE Vector4 Vector4::operator*(float InScale) const
+{
+	return Vector4(_mm_mul_ps(ToRegister(), _mm_set1_ps(InScale)));
+}
+
+FORCEINLINE Vector4 Vector4::operator/(float InScale) const
+{
+	return Vector4(_mm_div_ps(ToRegister(), _mm_set1_ps(InScale)));
+}
+
+FORCEINLINE Vector4 Vector4::operator+(const Vector4& InV) const
+{
+	return Vector4(_mm_add_ps(ToRegister(), InV.ToRegister()));
+}
+
+FORCEINLINE Vector4 Vector4::operator-(const Vector4& InV) const
+{
+	return Vector4(_mm_sub_ps(ToRegister(), InV.ToRegister()));
+}
+
+FORCEINLINE Vector4& Vector4::operator*=(float InScale)
+{
+	_mm_store_ps(&X, _mm_mul_ps(ToRegister(), _mm_set1_ps(InScale)));
+	return *this;
+}
+
+FORCEINLINE Vector4& Vector4::operator/=(float InScale)
+{
+	_mm_store_ps(&X, _mm_div_ps(ToRegister(), _mm_set1_ps(InScale)));
+	return *this;
+}
+
+FORCEINLINE Vector4& Vector4::operator+=(const Vector4& InV)
+{
+	_mm_store_ps(&X, _mm_add_ps(ToRegister(), InV.ToRegister()));
+	return *this;
+}
+
+FORCEINLINE Vector4& Vector4::operator-=(const Vector4& InV)
+{
+	_mm_store_ps(&X, _mm_sub_ps(ToRegister(), InV.ToRegister()));
+	return *this;
+}
+#else
 FORCEINLINE Vector4 Vector4::operator-() const
 {
 	return Vector4(-X, -Y, -Z, -W);
@@ -163,6 +241,7 @@ FORCEINLINE Vector4& Vector4::operator-=(const Vector4& InV)
 	W -= InV.W;
 	return *this;
 }
+#endif
 
 FORCEINLINE bool Vector4::EqualsInTolerance(const Vector4& InVector, float InTolerance) const
 {
@@ -180,7 +259,7 @@ FORCEINLINE float Vector4::Max() const
 }
 
 
-FORCEINLINE float Vector4::Dot(const Vector4& InV) const
+FORCEINLINE constexpr float Vector4::Dot(const Vector4& InV) const
 {
 	return X * InV.X + Y * InV.Y + Z * InV.Z + W * InV.W;
 }
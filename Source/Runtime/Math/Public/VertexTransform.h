@@ -0,0 +1,22 @@
+#pragma once
+
+namespace CK
+{
+
+// Transforms of many points at once over structure-of-arrays positions.
+// Each kernel reads the X, Y and Z arrays as points with W = 1 and processes eight points per
+// iteration with AVX2, four with SSE and the remainder one by one. Output arrays may be the input arrays.
+struct VertexTransform
+{
+	// Clip space positions.
+	static void TransformPoints(const Matrix4x4& InMatrix, const float* InX, const float* InY, const float* InZ,
+		float* OutX, float* OutY, float* OutZ, float* OutW, int InCount);
+
+	// Transforms, divides by W and maps normalized X and Y to pixels the way ScreenPoint::ToScreenCoordinate does
+	// : the screen center is the origin and Y points up before the mapping. Flooring the output gives the pixel.
+	// Z is the normalized depth. Points have to be in front of the camera (W > 0).
+	static void ProjectToScreen(const Matrix4x4& InMatrix, const ScreenPoint& InScreenSize, const float* InX, const float* InY, const float* InZ,
+		float* OutX, float* OutY, float* OutZ, int InCount);
+};
+
+}
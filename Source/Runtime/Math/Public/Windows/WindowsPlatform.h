@@ -2,3 +2,7 @@
 #pragma once
 
 #define FORCEINLINE __forceinline
+
+#include <malloc.h>
+#define ALIGNED_MALLOC(InSize, InAlignment) _aligned_malloc((InSize), (InAlignment))
+#define ALIGNED_FREE(InPointer) _aligned_free(InPointer)
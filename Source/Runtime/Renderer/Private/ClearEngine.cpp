@@ -0,0 +1,122 @@
+#include "Precompiled.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+void ClearEngine::ClearColor(Color32* InDest, UINT32 InCount, Color32 InColor)
+{
+	Fill(reinterpret_cast<UINT32*>(InDest), InCount, InColor.GetColorRef());
+}
+
+void ClearEngine::ClearDepth(void* InDest, UINT32 InCount, DepthFormat InFormat)
+{
+	// Compact formats are filled as 32-bit words holding several pixels, with a trailing half word for an odd count.
+	UINT32 byteCount = InCount * DepthBufferFormat::GetPixelSize(InFormat);
+	UINT32 pattern = DepthBufferFormat::GetClearPattern(InFormat);
+	Fill(static_cast<UINT32*>(InDest), byteCount / sizeof(UINT32), pattern);
+	if (byteCount % sizeof(UINT32) != 0)
+	{
+		static_cast<UINT16*>(InDest)[InCount - 1] = (UINT16)pattern;
+	}
+}
+
+void ClearEngine::Fill(UINT32* InDest, UINT32 InCount, UINT32 InValue)
+{
+	if (InDest == nullptr || InCount == 0)
+	{
+		return;
+	}
+
+	if (InCount < StreamingThreshold)
+	{
+		FillScalar(InDest, InCount, InValue);
+		return;
+	}
+
+	if (InCount < ParallelThreshold)
+	{
+		FillStreaming(InDest, InCount, InValue);
+		return;
+	}
+
+	StartWorkers();
+	if (_Workers.GetWorkerCount() == 0)
+	{
+		FillStreaming(InDest, InCount, InValue);
+		return;
+	}
+
+	_JobDest = InDest;
+	_JobCount = InCount;
+	_JobValue = InValue;
+
+	UINT32 partCount = _Workers.GetWorkerCount() + 1;
+	_Workers.Run(partCount, [this, partCount](UINT32 InPartIndex) { FillPart(InPartIndex, partCount); });
+}
+
+void ClearEngine::FillPart(UINT32 InPartIndex, UINT32 InPartCount)
+{
+	// Parts start on 64 byte boundaries so workers never share a cache line.
+	static const UINT32 partAlignment = 16;
+	UINT32 partSize = (_JobCount + InPartCount - 1) / InPartCount;
+	partSize = (partSize + partAlignment - 1) / partAlignment * partAlignment;
+
+	UINT32 begin = Math::Min(InPartIndex * partSize, _JobCount);
+	UINT32 end = Math::Min(begin + partSize, _JobCount);
+	if (begin < end)
+	{
+		FillStreaming(_JobDest + begin, end - begin, _JobValue);
+	}
+}
+
+void ClearEngine::StartWorkers()
+{
+	if (_WorkersStarted)
+	{
+		return;
+	}
+
+	_Workers.Start(Math::Min(WorkerPool::GetDefaultWorkerCount(), MaxWorkerCount));
+	_WorkersStarted = true;
+}
+
+void ClearEngine::FillScalar(UINT32* InDest, UINT32 InCount, UINT32 InValue)
+{
+	std::fill_n(InDest, InCount, InValue);
+}
+
+void ClearEngine::FillStreaming(UINT32* InDest, UINT32 InCount, UINT32 InValue)
+{
+	UINT32 i = 0;
+
+#if defined(PLATFORM_SIMD_AVX2)
+	while (i < InCount && (reinterpret_cast<uintptr_t>(InDest + i) & 31))
+	{
+		InDest[i++] = InValue;
+	}
+
+	const __m256i value8 = _mm256_set1_epi32((int)InValue);
+	for (; i + 8 <= InCount; i += 8)
+	{
+		_mm256_stream_si256(reinterpret_cast<__m256i*>(InDest + i), value8);
+	}
+	_mm_sfence();
+#elif defined(PLATFORM_SIMD_SSE2)
+	while (i < InCount && (reinterpret_cast<uintptr_t>(InDest + i) & 15))
+	{
+		InDest[i++] = InValue;
+	}
+
+	const __m128i value4 = _mm_set1_epi32((int)InValue);
+	for (; i + 4 <= InCount; i += 4)
+	{
+		_mm_stream_si128(reinterpret_cast<__m128i*>(InDest + i), value4);
+	}
+	_mm_sfence();
+#endif
+
+	for (; i < InCount; ++i)
+	{
+		InDest[i] = InValue;
+	}
+}
@@ -0,0 +1,95 @@
+#include "Precompiled.h"
+
+UINT32 DepthBufferFormat::GetPixelSize(DepthFormat InFormat)
+{
+	switch (InFormat)
+	{
+	case DepthFormat::D24S8:
+		return sizeof(DepthFormatD24S8::StorageType);
+	case DepthFormat::D16:
+		return sizeof(DepthFormatD16::StorageType);
+	default:
+		return sizeof(DepthFormatD32F::StorageType);
+	}
+}
+
+UINT32 DepthBufferFormat::GetClearPattern(DepthFormat InFormat)
+{
+	switch (InFormat)
+	{
+	case DepthFormat::D24S8:
+		return DepthFormatD24S8::ClearPattern;
+	case DepthFormat::D16:
+		return DepthFormatD16::ClearPattern;
+	default:
+		return DepthFormatD32F::ClearPattern;
+	}
+}
+
+float DepthBufferFormat::GetClearKey(DepthFormat InFormat)
+{
+	switch (InFormat)
+	{
+	case DepthFormat::D24S8:
+		return DepthFormatD24S8::GetClearKey();
+	case DepthFormat::D16:
+		return DepthFormatD16::GetClearKey();
+	default:
+		return DepthFormatD32F::GetClearKey();
+	}
+}
+
+float DepthBufferFormat::ToKey(DepthFormat InFormat, float InDepth)
+{
+	switch (InFormat)
+	{
+	case DepthFormat::D24S8:
+		return DepthFormatD24S8::ToKey(InDepth);
+	case DepthFormat::D16:
+		return DepthFormatD16::ToKey(InDepth);
+	default:
+		return DepthFormatD32F::ToKey(InDepth);
+	}
+}
+
+float DepthBufferFormat::FromKey(DepthFormat InFormat, float InKey)
+{
+	switch (InFormat)
+	{
+	case DepthFormat::D24S8:
+		return DepthFormatD24S8::FromKey(InKey);
+	case DepthFormat::D16:
+		return DepthFormatD16::FromKey(InKey);
+	default:
+		return DepthFormatD32F::FromKey(InKey);
+	}
+}
+
+float DepthBufferFormat::LoadKey(DepthFormat InFormat, const void* InBuffer, size_t InIndex)
+{
+	switch (InFormat)
+	{
+	case DepthFormat::D24S8:
+		return DepthFormatD24S8::Load(static_cast<const UINT32*>(InBuffer)[InIndex]);
+	case DepthFormat::D16:
+		return DepthFormatD16::Load(static_cast<const UINT16*>(InBuffer)[InIndex]);
+	default:
+		return DepthFormatD32F::Load(static_cast<const float*>(InBuffer)[InIndex]);
+	}
+}
+
+void DepthBufferFormat::StoreKey(DepthFormat InFormat, void* InBuffer, size_t InIndex, float InKey)
+{
+	switch (InFormat)
+	{
+	case DepthFormat::D24S8:
+		DepthFormatD24S8::Store(static_cast<UINT32*>(InBuffer)[InIndex], InKey);
+		break;
+	case DepthFormat::D16:
+		DepthFormatD16::Store(static_cast<UINT16*>(InBuffer)[InIndex], InKey);
+		break;
+	default:
+		DepthFormatD32F::Store(static_cast<float*>(InBuffer)[InIndex], InKey);
+		break;
+	}
+}
@@ -0,0 +1,131 @@
+#include "Precompiled.h"
+#include <algorithm>
+
+void DirtyTileMask::Initialize(const ScreenPoint& InScreenSize)
+{
+	_ScreenSize = InScreenSize;
+	_TileCountX = (InScreenSize.X + TileSize - 1) >> TileShift;
+	_TileCountY = (InScreenSize.Y + TileSize - 1) >> TileShift;
+
+	size_t wordCount = ((size_t)_TileCountX * _TileCountY + 63) / 64;
+	_DirtyBits.assign(wordCount, 0);
+	_ClearBits.assign(wordCount, 0);
+	_HasClearSource = false;
+
+	MarkAll();
+}
+
+void DirtyTileMask::Release()
+{
+	_ScreenSize = ScreenPoint();
+	_TileCountX = 0;
+	_TileCountY = 0;
+	_DirtyBits.clear();
+	_ClearBits.clear();
+	_HasClearSource = false;
+}
+
+void DirtyTileMask::MarkRect(int InMinX, int InMinY, int InMaxX, int InMaxY)
+{
+	InMinX = Math::Max(InMinX, 0);
+	InMinY = Math::Max(InMinY, 0);
+	InMaxX = Math::Min(InMaxX, _ScreenSize.X);
+	InMaxY = Math::Min(InMaxY, _ScreenSize.Y);
+	if (InMinX >= InMaxX || InMinY >= InMaxY)
+	{
+		return;
+	}
+
+	int endTileX = (InMaxX - 1) >> TileShift;
+	int endTileY = (InMaxY - 1) >> TileShift;
+	for (int tileY = InMinY >> TileShift; tileY <= endTileY; ++tileY)
+	{
+		for (int tileX = InMinX >> TileShift; tileX <= endTileX; ++tileX)
+		{
+			MarkTile(tileY * _TileCountX + tileX);
+		}
+	}
+}
+
+void DirtyTileMask::MarkAll()
+{
+	std::fill(_DirtyBits.begin(), _DirtyBits.end(), ~0ull);
+	std::fill(_ClearBits.begin(), _ClearBits.end(), 0ull);
+}
+
+void DirtyTileMask::OnClear(UINT64 InClearSource)
+{
+	if (_HasClearSource && _ClearSource == InClearSource)
+	{
+		// Only tiles written since the previous clear change their content.
+		for (size_t i = 0; i < _DirtyBits.size(); ++i)
+		{
+			_DirtyBits[i] |= ~_ClearBits[i];
+		}
+	}
+	else
+	{
+		std::fill(_DirtyBits.begin(), _DirtyBits.end(), ~0ull);
+	}
+
+	std::fill(_ClearBits.begin(), _ClearBits.end(), ~0ull);
+	_ClearSource = InClearSource;
+	_HasClearSource = true;
+}
+
+void DirtyTileMask::Flush(std::vector<Rect>& OutRects)
+{
+	// Runs of dirty tiles in a row become rectangles, and a run with the same
+	// horizontal extent as one in the row above extends that rectangle instead.
+	std::vector<size_t> openRects;
+	std::vector<size_t> nextOpenRects;
+	for (int tileY = 0; tileY < _TileCountY; ++tileY)
+	{
+		nextOpenRects.clear();
+		int minY = tileY << TileShift;
+		int maxY = Math::Min(minY + TileSize, _ScreenSize.Y);
+
+		int tileX = 0;
+		while (tileX < _TileCountX)
+		{
+			if (!IsDirtyTile(tileY * _TileCountX + tileX))
+			{
+				++tileX;
+				continue;
+			}
+
+			int startTileX = tileX;
+			while (tileX < _TileCountX && IsDirtyTile(tileY * _TileCountX + tileX))
+			{
+				++tileX;
+			}
+
+			int minX = startTileX << TileShift;
+			int maxX = Math::Min(tileX << TileShift, _ScreenSize.X);
+
+			auto found = std::find_if(openRects.begin(), openRects.end(), [&](size_t InIndex) {
+				return OutRects[InIndex].MinX == minX && OutRects[InIndex].MaxX == maxX;
+			});
+
+			if (found != openRects.end())
+			{
+				OutRects[*found].MaxY = maxY;
+				nextOpenRects.push_back(*found);
+			}
+			else
+			{
+				Rect rect;
+				rect.MinX = minX;
+				rect.MinY = minY;
+				rect.MaxX = maxX;
+				rect.MaxY = maxY;
+				OutRects.push_back(rect);
+				nextOpenRects.push_back(OutRects.size() - 1);
+			}
+		}
+
+		openRects.swap(nextOpenRects);
+	}
+
+	std::fill(_DirtyBits.begin(), _DirtyBits.end(), 0ull);
+}
@@ -0,0 +1,333 @@
+#include "Precompiled.h"
+
+bool FrameBuffer::InitializeBuffer(const ScreenPoint& InScreenSize, const RenderingSettings& InSettings)
+{
+	ReleaseBuffer();
+
+	if (InScreenSize.X <= 0 || InScreenSize.Y <= 0)
+	{
+		return false;
+	}
+
+	_ScreenSize = InScreenSize;
+
+	// Color Buffer Setting
+	_Settings = InSettings;
+	_Settings.BufferCount = Math::Clamp(_Settings.BufferCount, 1u, SwapChain::MaxBufferCount);
+	_Settings.WorkerCount = Math::Min(_Settings.WorkerCount, WorkerPool::MaxWorkerCount);
+	if (!CreateColorBuffers(_Settings.BufferCount))
+	{
+		ReleaseBuffer();
+		return false;
+	}
+	_ScreenBuffer = _ColorBuffers[0];
+
+	// Create Depth Buffer
+	CreateDepthBuffer();
+	if (_DepthBuffer == nullptr)
+	{
+		ReleaseBuffer();
+		return false;
+	}
+
+	_ColorClearState.Initialize(_ScreenBuffer, _ScreenSize);
+	_DepthClearState.Initialize(_DepthBuffer, _ScreenSize, DepthBufferFormat::GetPixelSize(_Settings.Depth));
+	_HierarchicalDepth.Initialize(_ScreenSize);
+	_DirtyTiles.Initialize(_ScreenSize);
+
+	if (_Settings.Rasterizer == RasterizerMode::TileBinned)
+	{
+		UINT32 workerCount = _Settings.WorkerCount > 0 ? _Settings.WorkerCount : WorkerPool::GetDefaultWorkerCount();
+		_TileRasterizer.Initialize(_ScreenBuffer, _DepthBuffer, _Settings.Depth, &_HierarchicalDepth, _ScreenSize, workerCount);
+	}
+
+	_SwapChain.Initialize(_Settings.BufferCount, [this](UINT32 InBufferIndex) { PresentBuffer(InBufferIndex); });
+	_BufferInitialized = true;
+	return true;
+}
+
+void FrameBuffer::ReleaseBuffer()
+{
+	// Frames still queued are presented from the buffers below.
+	_SwapChain.Release();
+
+	ReleaseColorBuffers();
+	for (UINT32 i = 0; i < SwapChain::MaxBufferCount; ++i)
+	{
+		_ColorBuffers[i] = nullptr;
+		_PresentRects[i].clear();
+	}
+	_ScreenBuffer = nullptr;
+
+	if (_DepthBuffer != nullptr)
+	{
+		ALIGNED_FREE(_DepthBuffer);
+		_DepthBuffer = nullptr;
+	}
+
+	_ColorClearState.Release();
+	_DepthClearState.Release();
+	_HierarchicalDepth.Release();
+	_DirtyTiles.Release();
+	_TileRasterizer.Release();
+	_BackgroundLayer.Release();
+	_CapturingLayer = false;
+	_ClearedFromLayer = false;
+
+	_BufferInitialized = false;
+}
+
+void FrameBuffer::FillBuffer(Color32 InColor)
+{
+	if (!_BufferInitialized || (_ScreenBuffer == nullptr))
+	{
+		return;
+	}
+
+	// Recorded rectangles would be overwritten anyway, but recorded triangles still have to write their depth.
+	if (_TileRasterizer.HasPendingTriangles())
+	{
+		_TileRasterizer.Flush();
+	}
+	else
+	{
+		_TileRasterizer.Discard();
+	}
+
+	_LastClearColor = InColor;
+	_ClearedFromLayer = _BackgroundLayer.IsValid() && _BackgroundLayer.GetBaseColor() == InColor;
+	if (_ClearedFromLayer)
+	{
+		_DirtyTiles.OnClear(_BackgroundLayer.GetSourceId());
+		_ColorClearState.Discard();
+		_BackgroundLayer.CopyTo(_ScreenBuffer);
+		return;
+	}
+
+	_DirtyTiles.OnClear(InColor.GetColorRef());
+
+	UINT32 totalCount = _ScreenSize.X * _ScreenSize.Y;
+	if (_FastClearEnabled)
+	{
+		_ColorClearState.Clear(InColor.GetColorRef());
+		return;
+	}
+
+	_ColorClearState.Discard();
+	_ClearEngine.ClearColor(_ScreenBuffer, totalCount, InColor);
+}
+
+bool FrameBuffer::BeginLayerCapture(UINT64 InKey)
+{
+	if (!_BufferInitialized)
+	{
+		return false;
+	}
+
+	if (_BackgroundLayer.IsValidFor(InKey) && _BackgroundLayer.GetBaseColor() == _LastClearColor)
+	{
+		return false;
+	}
+
+	// A stale layer copied by the last clear has to be replaced with the plain clear color.
+	bool clearedFromLayer = _ClearedFromLayer;
+	_BackgroundLayer.Invalidate();
+	if (clearedFromLayer)
+	{
+		FillBuffer(_LastClearColor);
+	}
+
+	if (!_BackgroundLayer.IsAllocated() && !_BackgroundLayer.Allocate(_ScreenSize))
+	{
+		return true;
+	}
+
+	_BackgroundLayerKey = InKey;
+	_CapturingLayer = true;
+	return true;
+}
+
+void FrameBuffer::EndLayerCapture()
+{
+	if (!_CapturingLayer)
+	{
+		return;
+	}
+
+	_CapturingLayer = false;
+	_TileRasterizer.Flush();
+	_ColorClearState.Resolve();
+	_BackgroundLayer.Capture(_ScreenBuffer, _BackgroundLayerKey, _LastClearColor);
+	_DirtyTiles.OnClear(_BackgroundLayer.GetSourceId());
+}
+
+Color32* FrameBuffer::GetScreenBuffer()
+{
+	// Readback needs every deferred clear and draw in place.
+	_TileRasterizer.Flush();
+	_ColorClearState.Resolve();
+	return _ScreenBuffer;
+}
+
+void FrameBuffer::WriteRect(int InMinX, int InMinY, int InMaxX, int InMaxY, Color32 InColor, BlendMode InBlendMode)
+{
+	TouchRect(InMinX, InMinY, InMaxX, InMaxY, InBlendMode == BlendMode::Opaque);
+	if (_TileRasterizer.IsEnabled())
+	{
+		_TileRasterizer.AddRect(InMinX, InMinY, InMaxX, InMaxY, InColor, InBlendMode);
+		return;
+	}
+
+	Color32* dest = _ScreenBuffer + InMinY * _ScreenSize.X + InMinX;
+	if (InBlendMode != BlendMode::Opaque)
+	{
+		SpanBlend::BlendRect(dest, _ScreenSize.X, InMaxX - InMinX, InMaxY - InMinY, InColor, InBlendMode);
+	}
+	else
+	{
+		SpanFill::FillRect(dest, _ScreenSize.X, InMaxX - InMinX, InMaxY - InMinY, InColor);
+	}
+}
+
+void FrameBuffer::WriteTriangle(const TriangleSetup& InSetup)
+{
+	// Deferred triangles only bring stored depth closer, and depth writes that may move it farther flush them first,
+	// so bounds read before deferred draws are flushed stay conservative.
+	float nearestKey = DepthBufferFormat::ToKey(_Settings.Depth, TriangleRasterizer::GetNearestDepth(InSetup));
+	if (_HierarchicalDepth.IsOccluded(InSetup.MinX, InSetup.MinY, InSetup.MaxX, InSetup.MaxY, nearestKey))
+	{
+		_HierarchicalDepth.AddStatistics(1, 0, 0);
+		return;
+	}
+
+	// Rasterizer blocks never cross a deferred clear tile, so touching the bounds covers every block that is read.
+	TouchRect(InSetup.MinX, InSetup.MinY, InSetup.MaxX, InSetup.MaxY, false);
+	_DepthClearState.TouchRect(InSetup.MinX, InSetup.MinY, InSetup.MaxX, InSetup.MaxY);
+	if (_TileRasterizer.IsEnabled())
+	{
+		_TileRasterizer.AddTriangle(InSetup);
+		return;
+	}
+
+	TriangleRasterizer::Rasterize(InSetup, _ScreenBuffer, _DepthBuffer, _Settings.Depth, _ScreenSize.X, 0, 0, _ScreenSize.X, _ScreenSize.Y, &_HierarchicalDepth);
+}
+
+void FrameBuffer::SwapBuffer()
+{
+	PROFILE_SCOPE("SwapBuffer");
+	if (!_BufferInitialized)
+	{
+		return;
+	}
+
+	_TileRasterizer.Flush();
+	_ColorClearState.Resolve();
+
+	UINT32 bufferIndex = _SwapChain.GetBackBufferIndex();
+	FinishFrame(bufferIndex);
+
+	// The screen keeps the previous frame, so the present only copies what changed since then.
+	std::vector<DirtyTileMask::Rect>& presentRects = _PresentRects[bufferIndex];
+	presentRects.clear();
+	_DirtyTiles.Flush(presentRects);
+	_LastPresentedBytes = 0;
+	for (const DirtyTileMask::Rect& rect : presentRects)
+	{
+		int width = rect.MaxX - rect.MinX;
+		int height = rect.MaxY - rect.MinY;
+		_LastPresentedBytes += (UINT64)width * height * sizeof(Color32);
+	}
+	_TotalPresentedBytes += _LastPresentedBytes;
+
+	_PresentedFrameCount++;
+	_StatisticTexts.clear();
+	SetBackBuffer(_SwapChain.Submit());
+}
+
+void FrameBuffer::SetBackBuffer(UINT32 InBufferIndex)
+{
+	_ScreenBuffer = _ColorBuffers[InBufferIndex];
+	_ColorClearState.SetBuffer(_ScreenBuffer);
+	if (_TileRasterizer.IsEnabled())
+	{
+		_TileRasterizer.SetBuffer(_ScreenBuffer);
+	}
+}
+
+void FrameBuffer::CreateDepthBuffer()
+{
+	size_t totalCount = (size_t)_ScreenSize.X * _ScreenSize.Y;
+	_DepthBuffer = ALIGNED_MALLOC(totalCount * DepthBufferFormat::GetPixelSize(_Settings.Depth), BufferAlignment);
+}
+
+void FrameBuffer::ClearDepthBuffer()
+{
+	if (_DepthBuffer != nullptr)
+	{
+		// Deferred triangles still have to test against the old depth.
+		_TileRasterizer.Flush();
+		_HierarchicalDepth.Clear(DepthBufferFormat::GetClearKey(_Settings.Depth));
+
+		if (_FastClearEnabled)
+		{
+			_DepthClearState.Clear(DepthBufferFormat::GetClearPattern(_Settings.Depth));
+			return;
+		}
+
+		_DepthClearState.Discard();
+		UINT32 totalCount = _ScreenSize.X * _ScreenSize.Y;
+		_ClearEngine.ClearDepth(_DepthBuffer, totalCount, _Settings.Depth);
+	}
+}
+
+float FrameBuffer::GetDepthBufferValue(const ScreenPoint& InPos)
+{
+	if (_DepthBuffer == nullptr)
+	{
+		return INFINITY;
+	}
+
+	if (!IsInScreen(InPos))
+	{
+		return INFINITY;
+	}
+
+	// Deferred triangles have to reach the depth buffer first, as they would have in immediate mode.
+	if (_TileRasterizer.HasPendingTriangles())
+	{
+		_TileRasterizer.Flush();
+	}
+
+	float depthKey = DepthBufferFormat::GetClearKey(_Settings.Depth);
+	if (!_DepthClearState.IsPending(InPos.X, InPos.Y))
+	{
+		depthKey = DepthBufferFormat::LoadKey(_Settings.Depth, _DepthBuffer, GetScreenBufferIndex(InPos));
+	}
+
+	return DepthBufferFormat::FromKey(_Settings.Depth, depthKey);
+}
+
+void FrameBuffer::SetDepthBufferValue(const ScreenPoint& InPos, float InDepthValue)
+{
+	if (_DepthBuffer == nullptr)
+	{
+		return;
+	}
+
+	if (!IsInScreen(InPos))
+	{
+		return;
+	}
+
+	// Deferred triangles have to reach the depth buffer first, as they would have in immediate mode.
+	if (_TileRasterizer.HasPendingTriangles())
+	{
+		_TileRasterizer.Flush();
+	}
+
+	// Compact formats store the value clamped and rounded, and the bounds use the stored value.
+	float depthKey = DepthBufferFormat::ToKey(_Settings.Depth, InDepthValue);
+	_DepthClearState.Touch(InPos.X, InPos.Y);
+	DepthBufferFormat::StoreKey(_Settings.Depth, _DepthBuffer, GetScreenBufferIndex(InPos), depthKey);
+	_HierarchicalDepth.OnPixelWritten(InPos.X, InPos.Y, depthKey);
+}
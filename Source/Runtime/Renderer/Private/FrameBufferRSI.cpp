@@ -0,0 +1,189 @@
+#include "Precompiled.h"
+
+bool FrameBufferRSI::Init(const ScreenPoint& InScreenSize, const RenderingSettings& InSettings)
+{
+	return InitializeBuffer(InScreenSize, InSettings);
+}
+
+void FrameBufferRSI::Shutdown()
+{
+	ReleaseBuffer();
+}
+
+void FrameBufferRSI::Clear(const LinearColor & InClearColor)
+{
+	PROFILE_SCOPE("Clear");
+	FillBuffer(InClearColor.ToColor32());
+	ClearDepthBuffer();
+}
+
+void FrameBufferRSI::BeginFrame()
+{
+}
+
+void FrameBufferRSI::EndFrame()
+{
+	SwapBuffer();
+}
+
+void FrameBufferRSI::DrawFullVerticalLine(int InX, const LinearColor & InColor)
+{
+	PROFILE_SCOPE("DrawLine");
+	if (InX < 0 || InX >= _ScreenSize.X)
+	{
+		return;
+	}
+
+	Color32 color = InColor.ToColor32();
+	WriteRect(InX, 0, InX + 1, _ScreenSize.Y, color, GetDrawBlendMode(color));
+}
+
+void FrameBufferRSI::DrawFullHorizontalLine(int InY, const LinearColor & InColor)
+{
+	PROFILE_SCOPE("DrawLine");
+	if (InY < 0 || InY >= _ScreenSize.Y)
+	{
+		return;
+	}
+
+	Color32 color = InColor.ToColor32();
+	WriteRect(0, InY, _ScreenSize.X, InY + 1, color, GetDrawBlendMode(color));
+}
+
+void FrameBufferRSI::DrawFilledRect(const ScreenPoint& InStartPosition, const ScreenPoint& InSize, const LinearColor& InColor)
+{
+	int startX = Math::Max(InStartPosition.X, 0);
+	int startY = Math::Max(InStartPosition.Y, 0);
+	int endX = Math::Min(InStartPosition.X + InSize.X, _ScreenSize.X);
+	int endY = Math::Min(InStartPosition.Y + InSize.Y, _ScreenSize.Y);
+	if (startX >= endX || startY >= endY)
+	{
+		return;
+	}
+
+	Color32 color = InColor.ToColor32();
+	WriteRect(startX, startY, endX, endY, color, GetDrawBlendMode(color));
+}
+
+void FrameBufferRSI::DrawPoint(const Vector2& InVectorPos, const LinearColor& InColor)
+{
+	SetPixel(ScreenPoint::ToScreenCoordinate(_ScreenSize, InVectorPos), InColor);
+}
+
+void FrameBufferRSI::DrawPoints(const Vector2* InVectorPositions, const LinearColor* InColors, int InCount)
+{
+	if (!_BufferInitialized || InVectorPositions == nullptr || InColors == nullptr)
+	{
+		return;
+	}
+
+	const float halfWidth = _ScreenSize.X * 0.5f;
+	const float halfHeight = _ScreenSize.Y * 0.5f;
+	const UINT32 width = _ScreenSize.X;
+	const UINT32 height = _ScreenSize.Y;
+	for (int i = 0; i < InCount; ++i)
+	{
+		int x = Math::FloorToInt(InVectorPositions[i].X + halfWidth);
+		int y = Math::FloorToInt(-InVectorPositions[i].Y + halfHeight);
+		if ((UINT32)x >= width || (UINT32)y >= height)
+		{
+			continue;
+		}
+
+		WritePixel(x, y, InColors[i].ToColor32());
+	}
+}
+
+void FrameBufferRSI::DrawPoints(const Vector2* InVectorPositions, int InCount, const LinearColor& InColor)
+{
+	if (!_BufferInitialized || InVectorPositions == nullptr)
+	{
+		return;
+	}
+
+	const float halfWidth = _ScreenSize.X * 0.5f;
+	const float halfHeight = _ScreenSize.Y * 0.5f;
+	const UINT32 width = _ScreenSize.X;
+	const UINT32 height = _ScreenSize.Y;
+	const Color32 color = InColor.ToColor32();
+	for (int i = 0; i < InCount; ++i)
+	{
+		int x = Math::FloorToInt(InVectorPositions[i].X + halfWidth);
+		int y = Math::FloorToInt(-InVectorPositions[i].Y + halfHeight);
+		if ((UINT32)x >= width || (UINT32)y >= height)
+		{
+			continue;
+		}
+
+		WritePixel(x, y, color);
+	}
+}
+
+void FrameBufferRSI::DrawSpans(const ScreenPoint* InStartPositions, const int* InLengths, const LinearColor* InColors, int InCount)
+{
+	if (!_BufferInitialized || InStartPositions == nullptr || InLengths == nullptr || InColors == nullptr)
+	{
+		return;
+	}
+
+	for (int i = 0; i < InCount; ++i)
+	{
+		const ScreenPoint& start = InStartPositions[i];
+		if (start.Y < 0 || start.Y >= _ScreenSize.Y)
+		{
+			continue;
+		}
+
+		int startX = Math::Max(start.X, 0);
+		int endX = Math::Min(start.X + InLengths[i], _ScreenSize.X);
+		if (startX >= endX)
+		{
+			continue;
+		}
+
+		WriteRect(startX, start.Y, endX, start.Y + 1, InColors[i].ToColor32(), BlendMode::Opaque);
+	}
+}
+
+void FrameBufferRSI::DrawTriangle(const Vector3& InPosition0, const Vector3& InPosition1, const Vector3& InPosition2, const LinearColor& InColor)
+{
+	if (!_BufferInitialized)
+	{
+		return;
+	}
+
+	const Vector3 positions[3] = { InPosition0, InPosition1, InPosition2 };
+	const LinearColor colors[3] = { InColor, InColor, InColor };
+	TriangleSetup setup;
+	if (TriangleRasterizer::Setup(_ScreenSize, positions, colors, setup))
+	{
+		WriteTriangle(setup);
+	}
+}
+
+void FrameBufferRSI::DrawTriangles(const Vector3* InPositions, const LinearColor* InColors, int InTriangleCount)
+{
+	if (!_BufferInitialized || InPositions == nullptr || InColors == nullptr)
+	{
+		return;
+	}
+
+	TriangleSetup setup;
+	for (int i = 0; i < InTriangleCount; ++i)
+	{
+		if (TriangleRasterizer::Setup(_ScreenSize, InPositions + i * 3, InColors + i * 3, setup))
+		{
+			WriteTriangle(setup);
+		}
+	}
+}
+
+void FrameBufferRSI::PushStatisticText(std::string && InText)
+{
+	_StatisticTexts.emplace_back(InText);
+}
+
+void FrameBufferRSI::PushStatisticTexts(std::vector<std::string> && InTexts)
+{
+	std::move(InTexts.begin(), InTexts.end(), std::back_inserter(_StatisticTexts));
+}
@@ -0,0 +1,107 @@
+#include "Precompiled.h"
+#include <fstream>
+
+HeadlessRSI::~HeadlessRSI()
+{
+	ReleaseBuffer();
+}
+
+bool HeadlessRSI::CreateColorBuffers(UINT32 InBufferCount)
+{
+	size_t totalCount = (size_t)_ScreenSize.X * _ScreenSize.Y;
+	for (UINT32 i = 0; i < InBufferCount; ++i)
+	{
+		_ColorBuffers[i] = static_cast<Color32*>(ALIGNED_MALLOC(totalCount * sizeof(Color32), BufferAlignment));
+		if (_ColorBuffers[i] == nullptr)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void HeadlessRSI::ReleaseColorBuffers()
+{
+	for (UINT32 i = 0; i < SwapChain::MaxBufferCount; ++i)
+	{
+		if (_ColorBuffers[i] != nullptr)
+		{
+			ALIGNED_FREE(_ColorBuffers[i]);
+			_ColorBuffers[i] = nullptr;
+		}
+
+		_PresentFrames[i].DumpPath.clear();
+	}
+}
+
+void HeadlessRSI::FinishFrame(UINT32 InBufferIndex)
+{
+	// The present gets the texts and the dump request of its frame, and the back buffer slot is free to reuse.
+	PresentFrame& frame = _PresentFrames[InBufferIndex];
+	frame.StatisticTexts.swap(_StatisticTexts);
+	frame.DumpPath.swap(_FrameDumpPath);
+	_FrameDumpPath.clear();
+}
+
+void HeadlessRSI::PresentBuffer(UINT32 InBufferIndex)
+{
+	PresentFrame& frame = _PresentFrames[InBufferIndex];
+	if (_PresentCallback)
+	{
+		_PresentCallback(_ColorBuffers[InBufferIndex], _ScreenSize);
+	}
+
+	if (!frame.DumpPath.empty())
+	{
+		WriteBufferToPPM(frame.DumpPath, _ColorBuffers[InBufferIndex], frame.StatisticTexts);
+		frame.DumpPath.clear();
+	}
+}
+
+void HeadlessRSI::RequestFrameDump(const std::string& InPath)
+{
+	_FrameDumpPath = InPath;
+}
+
+bool HeadlessRSI::WriteFrameToPPM(const std::string& InPath) const
+{
+	if (!_BufferInitialized)
+	{
+		return false;
+	}
+
+	return WriteBufferToPPM(InPath, _ScreenBuffer, _StatisticTexts);
+}
+
+bool HeadlessRSI::WriteBufferToPPM(const std::string& InPath, const Color32* InPixels, const std::vector<std::string>& InStatisticTexts) const
+{
+	std::ofstream file(InPath, std::ios::out | std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+
+	// Statistic texts are kept as comments of the header.
+	file << "P6\n";
+	for (const std::string& text : InStatisticTexts)
+	{
+		file << "# " << text << "\n";
+	}
+	file << _ScreenSize.X << " " << _ScreenSize.Y << "\n255\n";
+
+	std::vector<BYTE> row(_ScreenSize.X * 3);
+	for (int y = 0; y < _ScreenSize.Y; ++y)
+	{
+		const Color32* src = InPixels + y * _ScreenSize.X;
+		for (int x = 0; x < _ScreenSize.X; ++x)
+		{
+			row[x * 3] = src[x].R;
+			row[x * 3 + 1] = src[x].G;
+			row[x * 3 + 2] = src[x].B;
+		}
+		file.write(reinterpret_cast<const char*>(row.data()), row.size());
+	}
+
+	return file.good();
+}
@@ -0,0 +1,107 @@
+#include "Precompiled.h"
+#include <algorithm>
+
+void HierarchicalDepth::Initialize(const ScreenPoint& InScreenSize)
+{
+	_BlockCountX = (InScreenSize.X + BlockSize - 1) >> BlockShift;
+	_BlockCountY = (InScreenSize.Y + BlockSize - 1) >> BlockShift;
+	_CoarseCountX = (InScreenSize.X + CoarseSize - 1) >> CoarseShift;
+	_CoarseCountY = (InScreenSize.Y + CoarseSize - 1) >> CoarseShift;
+
+	_BlockMin.assign((size_t)_BlockCountX * _BlockCountY, INFINITY);
+	_BlockMax.assign((size_t)_BlockCountX * _BlockCountY, INFINITY);
+	_CoarseMax.assign((size_t)_CoarseCountX * _CoarseCountY, INFINITY);
+	_CoarseDirty.assign((size_t)_CoarseCountX * _CoarseCountY, 0);
+	ResetStatistics();
+}
+
+void HierarchicalDepth::Release()
+{
+	_BlockCountX = 0;
+	_BlockCountY = 0;
+	_CoarseCountX = 0;
+	_CoarseCountY = 0;
+	_BlockMin.clear();
+	_BlockMax.clear();
+	_CoarseMax.clear();
+	_CoarseDirty.clear();
+}
+
+void HierarchicalDepth::Clear(float InDepth)
+{
+	std::fill(_BlockMin.begin(), _BlockMin.end(), InDepth);
+	std::fill(_BlockMax.begin(), _BlockMax.end(), InDepth);
+	std::fill(_CoarseMax.begin(), _CoarseMax.end(), InDepth);
+	std::fill(_CoarseDirty.begin(), _CoarseDirty.end(), (BYTE)0);
+}
+
+bool HierarchicalDepth::IsOccluded(int InMinX, int InMinY, int InMaxX, int InMaxY, float InNearestDepth)
+{
+	if (!IsInitialized() || InMinX >= InMaxX || InMinY >= InMaxY)
+	{
+		return false;
+	}
+
+	int endCoarseX = (InMaxX - 1) >> CoarseShift;
+	int endCoarseY = (InMaxY - 1) >> CoarseShift;
+	for (int coarseY = InMinY >> CoarseShift; coarseY <= endCoarseY; ++coarseY)
+	{
+		for (int coarseX = InMinX >> CoarseShift; coarseX <= endCoarseX; ++coarseX)
+		{
+			int coarseIndex = coarseY * _CoarseCountX + coarseX;
+			float coarseMax = _CoarseDirty[coarseIndex] ? RefreshCoarseMax(coarseIndex) : _CoarseMax[coarseIndex];
+			if (InNearestDepth < coarseMax)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void HierarchicalDepth::AddStatistics(UINT64 InCulledTriangles, UINT64 InCulledBlocks, UINT64 InRasterizedBlocks)
+{
+	_CulledTriangles.fetch_add(InCulledTriangles, std::memory_order_relaxed);
+	_CulledBlocks.fetch_add(InCulledBlocks, std::memory_order_relaxed);
+	_RasterizedBlocks.fetch_add(InRasterizedBlocks, std::memory_order_relaxed);
+}
+
+DepthCullStatistics HierarchicalDepth::GetStatistics() const
+{
+	DepthCullStatistics statistics;
+	statistics.CulledTriangles = _CulledTriangles.load(std::memory_order_relaxed);
+	statistics.CulledBlocks = _CulledBlocks.load(std::memory_order_relaxed);
+	statistics.RasterizedBlocks = _RasterizedBlocks.load(std::memory_order_relaxed);
+	return statistics;
+}
+
+void HierarchicalDepth::ResetStatistics()
+{
+	_CulledTriangles = 0;
+	_CulledBlocks = 0;
+	_RasterizedBlocks = 0;
+}
+
+float HierarchicalDepth::RefreshCoarseMax(int InCoarseIndex)
+{
+	const int blocksPerCoarse = 1 << (CoarseShift - BlockShift);
+	int startBlockX = (InCoarseIndex % _CoarseCountX) * blocksPerCoarse;
+	int startBlockY = (InCoarseIndex / _CoarseCountX) * blocksPerCoarse;
+	int endBlockX = Math::Min(startBlockX + blocksPerCoarse, _BlockCountX);
+	int endBlockY = Math::Min(startBlockY + blocksPerCoarse, _BlockCountY);
+
+	float coarseMax = -INFINITY;
+	for (int blockY = startBlockY; blockY < endBlockY; ++blockY)
+	{
+		const float* blockMax = _BlockMax.data() + (size_t)blockY * _BlockCountX;
+		for (int blockX = startBlockX; blockX < endBlockX; ++blockX)
+		{
+			coarseMax = Math::Max(coarseMax, blockMax[blockX]);
+		}
+	}
+
+	_CoarseMax[InCoarseIndex] = coarseMax;
+	_CoarseDirty[InCoarseIndex] = 0;
+	return coarseMax;
+}
@@ -0,0 +1,192 @@
+#include "Precompiled.h"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+
+std::atomic<bool> Profiler::_Enabled{ false };
+std::mutex Profiler::_Mutex;
+std::vector<std::unique_ptr<Profiler::ThreadBuffer>> Profiler::_Buffers;
+thread_local Profiler::ThreadBuffer* Profiler::_ThreadBuffer = nullptr;
+
+namespace
+{
+	// Kept apart from the buffer so that naming a thread does not allocate one.
+	thread_local std::string ThreadName;
+}
+
+Profiler::ThreadBuffer& Profiler::RegisterThread()
+{
+	// Buffers stay alive after their thread exits so that its events can still be captured.
+	std::unique_ptr<ThreadBuffer> buffer = std::make_unique<ThreadBuffer>();
+	buffer->Events = std::make_unique<ProfileEvent[]>(EventCapacity);
+
+	std::lock_guard<std::mutex> lock(_Mutex);
+	buffer->ThreadIndex = (UINT32)_Buffers.size();
+	buffer->Name = ThreadName.empty() ? "Thread " + std::to_string(buffer->ThreadIndex) : ThreadName;
+	_ThreadBuffer = buffer.get();
+	_Buffers.emplace_back(std::move(buffer));
+	return *_ThreadBuffer;
+}
+
+void Profiler::SetThreadName(const std::string& InName)
+{
+	ThreadName = InName;
+	if (_ThreadBuffer != nullptr)
+	{
+		std::lock_guard<std::mutex> lock(_Mutex);
+		_ThreadBuffer->Name = InName;
+	}
+}
+
+void Profiler::Record(ThreadBuffer& InBuffer, const char* InName, UINT64 InStart, UINT32 InDepth)
+{
+	UINT64 index = InBuffer.WriteIndex.load(std::memory_order_relaxed);
+	ProfileEvent& event = InBuffer.Events[index & (EventCapacity - 1)];
+	event.Name = InName;
+	event.StartNanoSeconds = InStart;
+	event.EndNanoSeconds = GetTimeStamp();
+	event.Depth = InDepth;
+	event.ThreadIndex = InBuffer.ThreadIndex;
+	InBuffer.WriteIndex.store(index + 1, std::memory_order_release);
+}
+
+ProfileCapture Profiler::Capture()
+{
+	ProfileCapture capture;
+	std::lock_guard<std::mutex> lock(_Mutex);
+	for (const std::unique_ptr<ThreadBuffer>& buffer : _Buffers)
+	{
+		capture.ThreadNames.emplace_back(buffer->Name);
+
+		UINT64 writeIndex = buffer->WriteIndex.load(std::memory_order_acquire);
+		UINT64 begin = Math::Max(buffer->ReadIndex, writeIndex > EventCapacity ? writeIndex - EventCapacity : 0);
+		size_t first = capture.Events.size();
+		for (UINT64 index = begin; index < writeIndex; ++index)
+		{
+			capture.Events.emplace_back(buffer->Events[index & (EventCapacity - 1)]);
+		}
+
+		// A thread that kept recording during the copy may have overwritten the oldest slots : drop them,
+		// counting the slot of the event it may be writing right now.
+		UINT64 latestIndex = buffer->WriteIndex.load(std::memory_order_acquire);
+		if (latestIndex + 1 > begin + EventCapacity)
+		{
+			size_t overwritten = (size_t)Math::Min(latestIndex + 1 - begin - EventCapacity, writeIndex - begin);
+			capture.Events.erase(capture.Events.begin() + first, capture.Events.begin() + first + overwritten);
+		}
+	}
+
+	std::sort(capture.Events.begin(), capture.Events.end(), [](const ProfileEvent& InA, const ProfileEvent& InB) { return InA.StartNanoSeconds < InB.StartNanoSeconds; });
+	return capture;
+}
+
+void Profiler::Reset()
+{
+	std::lock_guard<std::mutex> lock(_Mutex);
+	for (const std::unique_ptr<ThreadBuffer>& buffer : _Buffers)
+	{
+		buffer->ReadIndex = buffer->WriteIndex.load(std::memory_order_acquire);
+	}
+}
+
+void ProfileCapture::Summarize(std::vector<ProfileZoneStatistics>& OutStatistics) const
+{
+	std::map<std::string, std::vector<double>> durations;
+	for (const ProfileEvent& event : Events)
+	{
+		durations[event.Name].emplace_back((event.EndNanoSeconds - event.StartNanoSeconds) * 1e-6);
+	}
+
+	OutStatistics.clear();
+	for (auto& zone : durations)
+	{
+		std::vector<double>& times = zone.second;
+		std::sort(times.begin(), times.end());
+
+		// Nearest rank percentiles.
+		auto percentile = [&times](double InPercent) { return times[(size_t)Math::Max(0.0, ceil(InPercent * times.size()) - 1.0)]; };
+		ProfileZoneStatistics statistics;
+		statistics.Name = zone.first;
+		statistics.Count = (UINT32)times.size();
+		for (double time : times)
+		{
+			statistics.TotalMilliSeconds += time;
+		}
+		statistics.MinMilliSeconds = times.front();
+		statistics.MaxMilliSeconds = times.back();
+		statistics.AverageMilliSeconds = statistics.TotalMilliSeconds / times.size();
+		statistics.P95MilliSeconds = percentile(0.95);
+		statistics.P99MilliSeconds = percentile(0.99);
+		OutStatistics.emplace_back(std::move(statistics));
+	}
+
+	std::sort(OutStatistics.begin(), OutStatistics.end(), [](const ProfileZoneStatistics& InA, const ProfileZoneStatistics& InB) { return InA.TotalMilliSeconds > InB.TotalMilliSeconds; });
+}
+
+std::vector<std::string> ProfileCapture::GetSummaryTexts() const
+{
+	std::vector<ProfileZoneStatistics> statistics;
+	Summarize(statistics);
+
+	std::vector<std::string> texts;
+	char line[160];
+	std::snprintf(line, sizeof(line), "%-20s %8s %9s %9s %9s %9s %9s", "zone", "count", "min ms", "avg ms", "p95 ms", "p99 ms", "max ms");
+	texts.emplace_back(line);
+	for (const ProfileZoneStatistics& zone : statistics)
+	{
+		std::snprintf(line, sizeof(line), "%-20s %8u %9.4f %9.4f %9.4f %9.4f %9.4f", zone.Name.c_str(), zone.Count,
+			zone.MinMilliSeconds, zone.AverageMilliSeconds, zone.P95MilliSeconds, zone.P99MilliSeconds, zone.MaxMilliSeconds);
+		texts.emplace_back(line);
+	}
+	return texts;
+}
+
+namespace
+{
+	void WriteJsonString(FILE* InFile, const std::string& InText)
+	{
+		std::fputc('"', InFile);
+		for (char character : InText)
+		{
+			if (character == '"' || character == '\\')
+			{
+				std::fputc('\\', InFile);
+			}
+			std::fputc((unsigned char)character < 0x20 ? ' ' : character, InFile);
+		}
+		std::fputc('"', InFile);
+	}
+}
+
+bool ProfileCapture::WriteChromeTrace(const std::string& InPath) const
+{
+	FILE* file = std::fopen(InPath.c_str(), "wb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+
+	// Complete events in microseconds from the first event, plus the thread names as metadata.
+	UINT64 origin = Events.empty() ? 0 : Events.front().StartNanoSeconds;
+	std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+	bool first = true;
+	for (size_t i = 0; i < ThreadNames.size(); ++i)
+	{
+		std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", first ? "" : ",\n", (UINT32)i);
+		WriteJsonString(file, ThreadNames[i]);
+		std::fputs("}}", file);
+		first = false;
+	}
+
+	for (const ProfileEvent& event : Events)
+	{
+		std::fputs(first ? "{\"name\":" : ",\n{\"name\":", file);
+		WriteJsonString(file, event.Name);
+		std::fprintf(file, ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", event.ThreadIndex,
+			(event.StartNanoSeconds - origin) * 1e-3, (event.EndNanoSeconds - event.StartNanoSeconds) * 1e-3);
+		first = false;
+	}
+
+	std::fputs("\n]}\n", file);
+	return std::fclose(file) == 0;
+}
@@ -0,0 +1,58 @@
+#include "Precompiled.h"
+#include <cstring>
+
+RetainedLayer::~RetainedLayer()
+{
+	Release();
+}
+
+bool RetainedLayer::Allocate(const ScreenPoint& InScreenSize)
+{
+	Release();
+
+	_PixelCount = InScreenSize.X * InScreenSize.Y;
+	_Pixels = static_cast<Color32*>(ALIGNED_MALLOC(_PixelCount * sizeof(Color32), 64));
+	if (_Pixels == nullptr)
+	{
+		_PixelCount = 0;
+		return false;
+	}
+
+	return true;
+}
+
+void RetainedLayer::Release()
+{
+	if (_Pixels != nullptr)
+	{
+		ALIGNED_FREE(_Pixels);
+		_Pixels = nullptr;
+	}
+
+	_PixelCount = 0;
+	_Valid = false;
+}
+
+void RetainedLayer::Capture(const Color32* InSource, UINT64 InKey, Color32 InBaseColor)
+{
+	if (_Pixels == nullptr)
+	{
+		return;
+	}
+
+	std::memcpy(_Pixels, InSource, _PixelCount * sizeof(Color32));
+	_Key = InKey;
+	_BaseColor = InBaseColor;
+	_Serial++;
+	_Valid = true;
+}
+
+void RetainedLayer::CopyTo(Color32* InDest) const
+{
+	if (!_Valid)
+	{
+		return;
+	}
+
+	std::memcpy(InDest, _Pixels, _PixelCount * sizeof(Color32));
+}
@@ -0,0 +1,256 @@
+#include "Precompiled.h"
+
+namespace
+{
+	FORCEINLINE UINT32 DivideBy255(UINT32 InValue)
+	{
+		// Exact rounded division for values up to 255 * 255 once the 128 bias is included.
+		return (InValue + (InValue >> 8)) >> 8;
+	}
+
+	// Scale and bias per channel in B, G, R, A order. The bias carries the rounding offset
+	// and every sum stays below 65536, so the row kernels can use 16-bit lanes.
+	struct BlendTerms
+	{
+		BlendTerms(Color32 InColor, BlendMode InMode)
+		{
+			const UINT32 alpha = InColor.A;
+			const Color32 premultiplied = SpanBlend::Premultiply(InColor);
+			const UINT32 channels[4] = { InColor.B, InColor.G, InColor.R, InColor.A };
+			const UINT32 premultipliedChannels[4] = { premultiplied.B, premultiplied.G, premultiplied.R, premultiplied.A };
+			for (int i = 0; i < 4; ++i)
+			{
+				switch (InMode)
+				{
+				case BlendMode::PremultipliedOver:
+					// A channel above alpha is not a valid premultiplied color and would overflow the lanes.
+					Scale[i] = 255 - alpha;
+					Bias[i] = Math::Min(channels[i], alpha) * 255 + 128;
+					break;
+				case BlendMode::Multiply:
+					Scale[i] = premultipliedChannels[i] + 255 - alpha;
+					Bias[i] = 128;
+					break;
+				default:
+					// Straight alpha keeps the unrounded product Src * A for one rounding step only.
+					Scale[i] = 255 - alpha;
+					Bias[i] = channels[i] * alpha + 128;
+					break;
+				}
+			}
+		}
+
+		FORCEINLINE bool IsIdentity() const
+		{
+			return Scale[0] == 255 && Scale[1] == 255 && Scale[2] == 255 && Scale[3] == 255
+				&& Bias[0] == 128 && Bias[1] == 128 && Bias[2] == 128 && Bias[3] == 128;
+		}
+
+		UINT32 Scale[4];
+		UINT32 Bias[4];
+	};
+
+	FORCEINLINE void BlendPixelTerms(Color32& InOutDest, const BlendTerms& InTerms)
+	{
+		InOutDest.B = (BYTE)DivideBy255(InOutDest.B * InTerms.Scale[0] + InTerms.Bias[0]);
+		InOutDest.G = (BYTE)DivideBy255(InOutDest.G * InTerms.Scale[1] + InTerms.Bias[1]);
+		InOutDest.R = (BYTE)DivideBy255(InOutDest.R * InTerms.Scale[2] + InTerms.Bias[2]);
+		InOutDest.A = (BYTE)DivideBy255(InOutDest.A * InTerms.Scale[3] + InTerms.Bias[3]);
+	}
+
+	FORCEINLINE void AddPixel(Color32& InOutDest, Color32 InColor)
+	{
+		InOutDest.B = (BYTE)Math::Min(InOutDest.B + InColor.B, 255);
+		InOutDest.G = (BYTE)Math::Min(InOutDest.G + InColor.G, 255);
+		InOutDest.R = (BYTE)Math::Min(InOutDest.R + InColor.R, 255);
+		InOutDest.A = (BYTE)Math::Min(InOutDest.A + InColor.A, 255);
+	}
+
+#if defined(PLATFORM_SIMD_SSE2)
+	FORCEINLINE __m128i BlendHalf(__m128i InDst, __m128i InScale, __m128i InBias)
+	{
+		__m128i value = _mm_add_epi16(_mm_mullo_epi16(InDst, InScale), InBias);
+		return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+	}
+#endif
+
+#if defined(PLATFORM_SIMD_AVX2)
+	FORCEINLINE __m256i BlendHalf(__m256i InDst, __m256i InScale, __m256i InBias)
+	{
+		__m256i value = _mm256_add_epi16(_mm256_mullo_epi16(InDst, InScale), InBias);
+		return _mm256_srli_epi16(_mm256_add_epi16(value, _mm256_srli_epi16(value, 8)), 8);
+	}
+#endif
+
+	void AddRow(Color32* InDest, int InCount, Color32 InColor)
+	{
+		int i = 0;
+
+#if defined(PLATFORM_SIMD_AVX2)
+		const __m256i color8 = _mm256_set1_epi32((int)InColor.GetColorRef());
+		for (; i + 8 <= InCount; i += 8)
+		{
+			__m256i* dest = reinterpret_cast<__m256i*>(InDest + i);
+			_mm256_storeu_si256(dest, _mm256_adds_epu8(_mm256_loadu_si256(dest), color8));
+		}
+#endif
+
+#if defined(PLATFORM_SIMD_SSE2)
+		const __m128i color4 = _mm_set1_epi32((int)InColor.GetColorRef());
+		for (; i + 4 <= InCount; i += 4)
+		{
+			__m128i* dest = reinterpret_cast<__m128i*>(InDest + i);
+			_mm_storeu_si128(dest, _mm_adds_epu8(_mm_loadu_si128(dest), color4));
+		}
+#endif
+
+		for (; i < InCount; ++i)
+		{
+			AddPixel(InDest[i], InColor);
+		}
+	}
+
+	void ScaleRow(Color32* InDest, int InCount, const BlendTerms& InTerms)
+	{
+		int i = 0;
+
+#if defined(PLATFORM_SIMD_SSE2)
+		const short scaleB = (short)InTerms.Scale[0], scaleG = (short)InTerms.Scale[1], scaleR = (short)InTerms.Scale[2], scaleA = (short)InTerms.Scale[3];
+		const short biasB = (short)InTerms.Bias[0], biasG = (short)InTerms.Bias[1], biasR = (short)InTerms.Bias[2], biasA = (short)InTerms.Bias[3];
+		const __m128i zero = _mm_setzero_si128();
+
+#if defined(PLATFORM_SIMD_AVX2)
+		const __m256i zero8 = _mm256_setzero_si256();
+		const __m256i scale8 = _mm256_set_epi16(scaleA, scaleR, scaleG, scaleB, scaleA, scaleR, scaleG, scaleB,
+			scaleA, scaleR, scaleG, scaleB, scaleA, scaleR, scaleG, scaleB);
+		const __m256i bias8 = _mm256_set_epi16(biasA, biasR, biasG, biasB, biasA, biasR, biasG, biasB,
+			biasA, biasR, biasG, biasB, biasA, biasR, biasG, biasB);
+		for (; i + 8 <= InCount; i += 8)
+		{
+			__m256i* dest = reinterpret_cast<__m256i*>(InDest + i);
+			__m256i pixels = _mm256_loadu_si256(dest);
+			__m256i low = BlendHalf(_mm256_unpacklo_epi8(pixels, zero8), scale8, bias8);
+			__m256i high = BlendHalf(_mm256_unpackhi_epi8(pixels, zero8), scale8, bias8);
+			_mm256_storeu_si256(dest, _mm256_packus_epi16(low, high));
+		}
+#endif
+
+		const __m128i scale4 = _mm_set_epi16(scaleA, scaleR, scaleG, scaleB, scaleA, scaleR, scaleG, scaleB);
+		const __m128i bias4 = _mm_set_epi16(biasA, biasR, biasG, biasB, biasA, biasR, biasG, biasB);
+		for (; i + 4 <= InCount; i += 4)
+		{
+			__m128i* dest = reinterpret_cast<__m128i*>(InDest + i);
+			__m128i pixels = _mm_loadu_si128(dest);
+			__m128i low = BlendHalf(_mm_unpacklo_epi8(pixels, zero), scale4, bias4);
+			__m128i high = BlendHalf(_mm_unpackhi_epi8(pixels, zero), scale4, bias4);
+			_mm_storeu_si128(dest, _mm_packus_epi16(low, high));
+		}
+#endif
+
+		for (; i < InCount; ++i)
+		{
+			BlendPixelTerms(InDest[i], InTerms);
+		}
+	}
+}
+
+void SpanBlend::BlendRow(Color32* InDest, int InCount, Color32 InColor, BlendMode InMode)
+{
+	if (IsOpaque(InColor, InMode))
+	{
+		SpanFill::FillRow(InDest, InCount, InColor);
+		return;
+	}
+
+	if (InMode == BlendMode::Additive)
+	{
+		Color32 premultiplied = Premultiply(InColor);
+		if (premultiplied.GetColorRef() != 0)
+		{
+			AddRow(InDest, InCount, premultiplied);
+		}
+		return;
+	}
+
+	const BlendTerms terms(InColor, InMode);
+	if (!terms.IsIdentity())
+	{
+		ScaleRow(InDest, InCount, terms);
+	}
+}
+
+void SpanBlend::BlendColumn(Color32* InDest, int InCount, int InPitch, Color32 InColor, BlendMode InMode)
+{
+	if (IsOpaque(InColor, InMode))
+	{
+		SpanFill::FillColumn(InDest, InCount, InPitch, InColor);
+		return;
+	}
+
+	Color32* dest = InDest;
+	if (InMode == BlendMode::Additive)
+	{
+		Color32 premultiplied = Premultiply(InColor);
+		for (int i = 0; i < InCount; ++i)
+		{
+			AddPixel(*dest, premultiplied);
+			dest += InPitch;
+		}
+		return;
+	}
+
+	const BlendTerms terms(InColor, InMode);
+	if (terms.IsIdentity())
+	{
+		return;
+	}
+
+	for (int i = 0; i < InCount; ++i)
+	{
+		BlendPixelTerms(*dest, terms);
+		dest += InPitch;
+	}
+}
+
+void SpanBlend::BlendRect(Color32* InDest, int InPitch, int InWidth, int InHeight, Color32 InColor, BlendMode InMode)
+{
+	if (InWidth == 1)
+	{
+		BlendColumn(InDest, InHeight, InPitch, InColor, InMode);
+		return;
+	}
+
+	for (int y = 0; y < InHeight; ++y)
+	{
+		BlendRow(InDest + y * InPitch, InWidth, InColor, InMode);
+	}
+}
+
+void SpanBlend::BlendPixel(Color32& InOutDest, Color32 InColor, BlendMode InMode)
+{
+	BlendColumn(&InOutDest, 1, 0, InColor, InMode);
+}
+
+bool SpanBlend::IsOpaque(Color32 InColor, BlendMode InMode)
+{
+	switch (InMode)
+	{
+	case BlendMode::Opaque:
+		return true;
+	case BlendMode::Alpha:
+	case BlendMode::PremultipliedOver:
+		return InColor.A == 255;
+	default:
+		return false;
+	}
+}
+
+Color32 SpanBlend::Premultiply(Color32 InColor)
+{
+	const UINT32 alpha = InColor.A;
+	return Color32(
+		(BYTE)DivideBy255(InColor.R * alpha + 128),
+		(BYTE)DivideBy255(InColor.G * alpha + 128),
+		(BYTE)DivideBy255(InColor.B * alpha + 128),
+		InColor.A);
+}
@@ -0,0 +1,63 @@
+#include "Precompiled.h"
+#include <cstdint>
+
+void SpanFill::FillRow(Color32* InDest, int InCount, Color32 InColor)
+{
+	UINT32* dest = reinterpret_cast<UINT32*>(InDest);
+	const UINT32 value = InColor.GetColorRef();
+	int i = 0;
+
+#if defined(PLATFORM_SIMD_AVX2)
+	while (i < InCount && (reinterpret_cast<uintptr_t>(dest + i) & 31))
+	{
+		dest[i++] = value;
+	}
+
+	const __m256i color8 = _mm256_set1_epi32((int)value);
+	for (; i + 8 <= InCount; i += 8)
+	{
+		_mm256_store_si256(reinterpret_cast<__m256i*>(dest + i), color8);
+	}
+#elif defined(PLATFORM_SIMD_SSE2)
+	while (i < InCount && (reinterpret_cast<uintptr_t>(dest + i) & 15))
+	{
+		dest[i++] = value;
+	}
+
+	const __m128i color4 = _mm_set1_epi32((int)value);
+	for (; i + 4 <= InCount; i += 4)
+	{
+		_mm_store_si128(reinterpret_cast<__m128i*>(dest + i), color4);
+	}
+#endif
+
+	for (; i < InCount; ++i)
+	{
+		dest[i] = value;
+	}
+}
+
+void SpanFill::FillColumn(Color32* InDest, int InCount, int InPitch, Color32 InColor)
+{
+	UINT32* dest = reinterpret_cast<UINT32*>(InDest);
+	const UINT32 value = InColor.GetColorRef();
+	for (int i = 0; i < InCount; ++i)
+	{
+		*dest = value;
+		dest += InPitch;
+	}
+}
+
+void SpanFill::FillRect(Color32* InDest, int InPitch, int InWidth, int InHeight, Color32 InColor)
+{
+	if (InWidth == 1)
+	{
+		FillColumn(InDest, InHeight, InPitch, InColor);
+		return;
+	}
+
+	for (int y = 0; y < InHeight; ++y)
+	{
+		FillRow(InDest + y * InPitch, InWidth, InColor);
+	}
+}
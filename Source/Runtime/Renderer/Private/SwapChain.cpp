@@ -0,0 +1,172 @@
+#include "Precompiled.h"
+
+SwapChain::~SwapChain()
+{
+	Release();
+}
+
+void SwapChain::Initialize(UINT32 InBufferCount, const PresentFunction& InPresent)
+{
+	Release();
+
+	_Present = InPresent;
+	_BufferCount = Math::Clamp(InBufferCount, 1u, MaxBufferCount);
+	_SubmittedCount.store(0);
+	_PresentedCount.store(0);
+	_Quit.store(false);
+	_LastLatencyNanoSeconds.store(0, std::memory_order_relaxed);
+	_TotalLatencyNanoSeconds.store(0, std::memory_order_relaxed);
+	_MaxLatencyNanoSeconds.store(0, std::memory_order_relaxed);
+	_LastQueueDepth = 0;
+	_MaxQueueDepth = 0;
+	_TotalQueueDepth = 0;
+	_StallNanoSeconds = 0;
+
+	if (_BufferCount > 1)
+	{
+		_PresentThread = std::thread(&SwapChain::PresentLoop, this);
+	}
+}
+
+void SwapChain::Release()
+{
+	if (_PresentThread.joinable())
+	{
+		_Quit.store(true);
+		Wake();
+		_PresentThread.join();
+	}
+
+	_Present = nullptr;
+}
+
+UINT32 SwapChain::Submit()
+{
+	UINT64 submitted = _SubmittedCount.load(std::memory_order_relaxed);
+	UINT32 bufferIndex = (UINT32)(submitted % _BufferCount);
+	_SubmitTimes[bufferIndex] = Profiler::GetTimeStamp();
+	if (!IsThreaded())
+	{
+		PresentBuffer(bufferIndex);
+		_SubmittedCount.store(submitted + 1);
+		_PresentedCount.store(submitted + 1);
+		_LastQueueDepth = 1;
+		_MaxQueueDepth = 1;
+		_TotalQueueDepth++;
+		return 0;
+	}
+
+	_SubmittedCount.store(submitted + 1);
+	Wake();
+
+	_LastQueueDepth = (UINT32)(submitted + 1 - _PresentedCount.load());
+	_MaxQueueDepth = Math::Max(_MaxQueueDepth, _LastQueueDepth);
+	_TotalQueueDepth += _LastQueueDepth;
+
+	// The next buffer is free once the frame drawn into it BufferCount frames ago is presented.
+	if (submitted + 1 - _PresentedCount.load() >= _BufferCount)
+	{
+		PROFILE_SCOPE("PresentWait");
+		UINT64 waitStart = Profiler::GetTimeStamp();
+		Wait([this, submitted]() { return submitted + 1 - _PresentedCount.load() < _BufferCount; });
+		_StallNanoSeconds += Profiler::GetTimeStamp() - waitStart;
+	}
+
+	return (UINT32)((submitted + 1) % _BufferCount);
+}
+
+void SwapChain::WaitForPresents()
+{
+	if (IsThreaded())
+	{
+		Wait([this]() { return _PresentedCount.load() == _SubmittedCount.load(); });
+	}
+}
+
+SwapChainStatistics SwapChain::GetStatistics() const
+{
+	SwapChainStatistics statistics;
+	statistics.SubmittedFrameCount = _SubmittedCount.load();
+	statistics.PresentedFrameCount = _PresentedCount.load();
+	if (statistics.PresentedFrameCount > 0)
+	{
+		statistics.LastLatencyMilliSeconds = _LastLatencyNanoSeconds.load(std::memory_order_relaxed) * 1e-6;
+		statistics.AverageLatencyMilliSeconds = _TotalLatencyNanoSeconds.load(std::memory_order_relaxed) * 1e-6 / statistics.PresentedFrameCount;
+		statistics.MaxLatencyMilliSeconds = _MaxLatencyNanoSeconds.load(std::memory_order_relaxed) * 1e-6;
+	}
+
+	if (statistics.SubmittedFrameCount > 0)
+	{
+		statistics.LastQueueDepth = _LastQueueDepth;
+		statistics.AverageQueueDepth = (double)_TotalQueueDepth / statistics.SubmittedFrameCount;
+		statistics.MaxQueueDepth = _MaxQueueDepth;
+	}
+
+	statistics.StallMilliSeconds = _StallNanoSeconds * 1e-6;
+	return statistics;
+}
+
+void SwapChain::PresentLoop()
+{
+	Profiler::SetThreadName("Present");
+	while (true)
+	{
+		UINT64 presented = _PresentedCount.load(std::memory_order_relaxed);
+		Wait([this, presented]() { return _SubmittedCount.load() != presented || _Quit.load(); });
+
+		// Frames submitted before the quit are still presented.
+		if (_SubmittedCount.load() == presented)
+		{
+			return;
+		}
+
+		PresentBuffer((UINT32)(presented % _BufferCount));
+		_PresentedCount.store(presented + 1);
+		Wake();
+	}
+}
+
+void SwapChain::PresentBuffer(UINT32 InBufferIndex)
+{
+	{
+		PROFILE_SCOPE("Present");
+		_Present(InBufferIndex);
+	}
+
+	UINT64 latency = Profiler::GetTimeStamp() - _SubmitTimes[InBufferIndex];
+	_LastLatencyNanoSeconds.store(latency, std::memory_order_relaxed);
+	_TotalLatencyNanoSeconds.store(_TotalLatencyNanoSeconds.load(std::memory_order_relaxed) + latency, std::memory_order_relaxed);
+	_MaxLatencyNanoSeconds.store(Math::Max(_MaxLatencyNanoSeconds.load(std::memory_order_relaxed), latency), std::memory_order_relaxed);
+}
+
+template<typename Predicate>
+void SwapChain::Wait(Predicate InCondition)
+{
+	for (int spin = 0; spin < WaitSpinCount; ++spin)
+	{
+		if (InCondition())
+		{
+			return;
+		}
+		std::this_thread::yield();
+	}
+
+	// Counters, the sleeper count and the checks are all sequentially consistent, so either the
+	// sleeper sees the new counter or the side that advanced it sees the sleeper.
+	std::unique_lock<std::mutex> lock(_SleepMutex);
+	_SleeperCount.fetch_add(1);
+	_SleepCondition.wait(lock, InCondition);
+	_SleeperCount.fetch_sub(1);
+}
+
+void SwapChain::Wake()
+{
+	if (_SleeperCount.load() > 0)
+	{
+		// Taking the mutex makes sure a sleeper that already checked its condition is waiting.
+		{
+			std::lock_guard<std::mutex> lock(_SleepMutex);
+		}
+		_SleepCondition.notify_all();
+	}
+}
@@ -0,0 +1,134 @@
+#include "Precompiled.h"
+#include <algorithm>
+
+void TileClearState::Initialize(void* InBuffer, const ScreenPoint& InScreenSize, UINT32 InPixelSize)
+{
+	_Buffer = static_cast<BYTE*>(InBuffer);
+	_PixelSize = InPixelSize;
+	_ScreenSize = InScreenSize;
+	_TileCountX = (InScreenSize.X + TileSize - 1) >> TileShift;
+	_TileCountY = (InScreenSize.Y + TileSize - 1) >> TileShift;
+	_PendingTiles.assign(_TileCountX * _TileCountY, 0);
+	_PendingCount = 0;
+}
+
+void TileClearState::Release()
+{
+	_Buffer = nullptr;
+	_ScreenSize = ScreenPoint();
+	_TileCountX = 0;
+	_TileCountY = 0;
+	_PendingCount = 0;
+	_PendingTiles.clear();
+}
+
+void TileClearState::Clear(UINT32 InClearValue)
+{
+	_ClearValue = InClearValue;
+	std::fill(_PendingTiles.begin(), _PendingTiles.end(), (BYTE)1);
+	_PendingCount = (int)_PendingTiles.size();
+}
+
+void TileClearState::Resolve()
+{
+	if (_PendingCount == 0)
+	{
+		return;
+	}
+
+	for (int tileY = 0; tileY < _TileCountY; ++tileY)
+	{
+		for (int tileX = 0; tileX < _TileCountX; ++tileX)
+		{
+			if (_PendingTiles[tileY * _TileCountX + tileX])
+			{
+				Materialize(tileX, tileY);
+			}
+		}
+	}
+}
+
+void TileClearState::Discard()
+{
+	if (_PendingCount == 0)
+	{
+		return;
+	}
+
+	std::fill(_PendingTiles.begin(), _PendingTiles.end(), (BYTE)0);
+	_PendingCount = 0;
+}
+
+void TileClearState::TouchRect(int InMinX, int InMinY, int InMaxX, int InMaxY, bool InFullOverwrite)
+{
+	if (_PendingCount == 0)
+	{
+		return;
+	}
+
+	InMinX = Math::Max(InMinX, 0);
+	InMinY = Math::Max(InMinY, 0);
+	InMaxX = Math::Min(InMaxX, _ScreenSize.X);
+	InMaxY = Math::Min(InMaxY, _ScreenSize.Y);
+	if (InMinX >= InMaxX || InMinY >= InMaxY)
+	{
+		return;
+	}
+
+	int startTileX = InMinX >> TileShift;
+	int startTileY = InMinY >> TileShift;
+	int endTileX = (InMaxX - 1) >> TileShift;
+	int endTileY = (InMaxY - 1) >> TileShift;
+	for (int tileY = startTileY; tileY <= endTileY; ++tileY)
+	{
+		for (int tileX = startTileX; tileX <= endTileX; ++tileX)
+		{
+			BYTE& pending = _PendingTiles[tileY * _TileCountX + tileX];
+			if (!pending)
+			{
+				continue;
+			}
+
+			// A tile that is about to be overwritten entirely never needs the clear value.
+			int tileMinX = tileX << TileShift;
+			int tileMinY = tileY << TileShift;
+			int tileMaxX = Math::Min(tileMinX + TileSize, _ScreenSize.X);
+			int tileMaxY = Math::Min(tileMinY + TileSize, _ScreenSize.Y);
+			if (InFullOverwrite && InMinX <= tileMinX && InMinY <= tileMinY && InMaxX >= tileMaxX && InMaxY >= tileMaxY)
+			{
+				pending = 0;
+				_PendingCount--;
+			}
+			else
+			{
+				Materialize(tileX, tileY);
+			}
+		}
+	}
+}
+
+void TileClearState::Materialize(int InTileX, int InTileY)
+{
+	int minX = InTileX << TileShift;
+	int minY = InTileY << TileShift;
+	int width = Math::Min(TileSize, _ScreenSize.X - minX);
+	int maxY = Math::Min(minY + TileSize, _ScreenSize.Y);
+
+	size_t pitch = (size_t)_ScreenSize.X * _PixelSize;
+	BYTE* dest = _Buffer + minY * pitch + minX * _PixelSize;
+	for (int y = minY; y < maxY; ++y)
+	{
+		if (_PixelSize == sizeof(UINT16))
+		{
+			std::fill_n(reinterpret_cast<UINT16*>(dest), width, (UINT16)_ClearValue);
+		}
+		else
+		{
+			std::fill_n(reinterpret_cast<UINT32*>(dest), width, _ClearValue);
+		}
+		dest += pitch;
+	}
+
+	_PendingTiles[InTileY * _TileCountX + InTileX] = 0;
+	_PendingCount--;
+}
@@ -0,0 +1,137 @@
+#include "Precompiled.h"
+
+void TileRasterizer::Initialize(Color32* InBuffer, void* InDepthBuffer, DepthFormat InDepthFormat, HierarchicalDepth* InHierarchicalDepth, const ScreenPoint& InScreenSize, UINT32 InWorkerCount)
+{
+	Release();
+
+	_Buffer = InBuffer;
+	_DepthBuffer = InDepthBuffer;
+	_DepthFormat = InDepthFormat;
+	_HierarchicalDepth = InHierarchicalDepth;
+	_ScreenSize = InScreenSize;
+	_TileCountX = (InScreenSize.X + TileSize - 1) >> TileShift;
+	_TileCountY = (InScreenSize.Y + TileSize - 1) >> TileShift;
+	_Bins.resize((size_t)_TileCountX * _TileCountY);
+	_ActiveTiles.reserve(_Bins.size());
+
+	_Workers.Start(InWorkerCount);
+}
+
+void TileRasterizer::Release()
+{
+	_Workers.Stop();
+
+	_Buffer = nullptr;
+	_DepthBuffer = nullptr;
+	_HierarchicalDepth = nullptr;
+	_ScreenSize = ScreenPoint();
+	_TileCountX = 0;
+	_TileCountY = 0;
+	_Commands.clear();
+	_Triangles.clear();
+	_Bins.clear();
+	_ActiveTiles.clear();
+}
+
+void TileRasterizer::Flush()
+{
+	if (_Commands.empty())
+	{
+		return;
+	}
+
+	PROFILE_SCOPE("TileFlush");
+	BinCommands();
+	_Workers.Run((UINT32)_ActiveTiles.size(), [this](UINT32 InIndex) { RasterizeTile(_ActiveTiles[InIndex]); });
+
+	_FlushedCommandCount += _Commands.size();
+	_Commands.clear();
+	_Triangles.clear();
+}
+
+void TileRasterizer::AddTriangle(const TriangleSetup& InSetup)
+{
+	Command command;
+	command.MinX = InSetup.MinX;
+	command.MinY = InSetup.MinY;
+	command.MaxX = InSetup.MaxX;
+	command.MaxY = InSetup.MaxY;
+	command.Color = InSetup.FlatColor;
+	command.Blend = BlendMode::Opaque;
+	command.Triangle = (int)_Triangles.size();
+	_Commands.push_back(command);
+	_Triangles.push_back(InSetup);
+}
+
+void TileRasterizer::Discard()
+{
+	_Commands.clear();
+	_Triangles.clear();
+}
+
+void TileRasterizer::BinCommands()
+{
+	for (UINT32 tileIndex : _ActiveTiles)
+	{
+		_Bins[tileIndex].clear();
+	}
+	_ActiveTiles.clear();
+
+	for (UINT32 commandIndex = 0; commandIndex < (UINT32)_Commands.size(); ++commandIndex)
+	{
+		const Command& command = _Commands[commandIndex];
+		int endTileX = (command.MaxX - 1) >> TileShift;
+		int endTileY = (command.MaxY - 1) >> TileShift;
+		for (int tileY = command.MinY >> TileShift; tileY <= endTileY; ++tileY)
+		{
+			for (int tileX = command.MinX >> TileShift; tileX <= endTileX; ++tileX)
+			{
+				UINT32 tileIndex = tileY * _TileCountX + tileX;
+				std::vector<UINT32>& bin = _Bins[tileIndex];
+				if (bin.empty())
+				{
+					_ActiveTiles.push_back(tileIndex);
+				}
+				bin.push_back(commandIndex);
+			}
+		}
+	}
+}
+
+void TileRasterizer::RasterizeTile(UINT32 InTileIndex)
+{
+	PROFILE_SCOPE("RasterizeTile");
+	int tileMinX = (InTileIndex % _TileCountX) << TileShift;
+	int tileMinY = (InTileIndex / _TileCountX) << TileShift;
+	int tileMaxX = Math::Min(tileMinX + TileSize, _ScreenSize.X);
+	int tileMaxY = Math::Min(tileMinY + TileSize, _ScreenSize.Y);
+
+	for (UINT32 commandIndex : _Bins[InTileIndex])
+	{
+		const Command& command = _Commands[commandIndex];
+		if (command.Triangle >= 0)
+		{
+			TriangleRasterizer::Rasterize(_Triangles[command.Triangle], _Buffer, _DepthBuffer, _DepthFormat, _ScreenSize.X, tileMinX, tileMinY, tileMaxX, tileMaxY, _HierarchicalDepth);
+			continue;
+		}
+
+		int minX = Math::Max(command.MinX, tileMinX);
+		int minY = Math::Max(command.MinY, tileMinY);
+		int maxX = Math::Min(command.MaxX, tileMaxX);
+		int maxY = Math::Min(command.MaxY, tileMaxY);
+
+		Color32* dest = _Buffer + minY * _ScreenSize.X + minX;
+		if (command.Blend != BlendMode::Opaque)
+		{
+			SpanBlend::BlendRect(dest, _ScreenSize.X, maxX - minX, maxY - minY, command.Color, command.Blend);
+		}
+		else if (maxX - minX == 1 && maxY - minY == 1)
+		{
+			*dest = command.Color;
+		}
+		else
+		{
+			SpanFill::FillRect(dest, _ScreenSize.X, maxX - minX, maxY - minY, command.Color);
+		}
+	}
+}
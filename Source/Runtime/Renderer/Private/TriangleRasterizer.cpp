@@ -0,0 +1,520 @@
+#include "Precompiled.h"
+
+namespace
+{
+	const INT64 EdgeClampRange = 1ll << 30;
+
+	FORCEINLINE int ClampEdge(INT64 InValue)
+	{
+		return (int)Math::Clamp(InValue, -EdgeClampRange, EdgeClampRange);
+	}
+
+	FORCEINLINE UINT32 PackColor(float InR, float InG, float InB, float InA)
+	{
+		// Same conversion as LinearColor::ToColor32.
+		Color32 color(
+			(BYTE)(Math::Clamp(InR, 0.f, 1.f) * 255.999f),
+			(BYTE)(Math::Clamp(InG, 0.f, 1.f) * 255.999f),
+			(BYTE)(Math::Clamp(InB, 0.f, 1.f) * 255.999f),
+			(BYTE)(Math::Clamp(InA, 0.f, 1.f) * 255.999f));
+		return color.GetColorRef();
+	}
+
+	template <typename DepthType>
+	bool ShadePixel(const TriangleSetup& InSetup, int InOffsetX, int InOffsetY, Color32* InColor, typename DepthType::StorageType* InDepth, float& OutDepthKey)
+	{
+		float z = InSetup.Z + InSetup.ZStepX * InOffsetX + InSetup.ZStepY * InOffsetY;
+		float depthKey = DepthType::ToKey(z);
+		if (!(depthKey < DepthType::Load(*InDepth)))
+		{
+			return false;
+		}
+
+		DepthType::Store(*InDepth, depthKey);
+		OutDepthKey = depthKey;
+		if (InSetup.IsFlatColor)
+		{
+			*InColor = InSetup.FlatColor;
+			return true;
+		}
+
+		float channels[4];
+		for (int i = 0; i < 4; ++i)
+		{
+			channels[i] = InSetup.Color[i] + InSetup.ColorStepX[i] * InOffsetX + InSetup.ColorStepY[i] * InOffsetY;
+		}
+		InColor->GetColorRef() = PackColor(channels[0], channels[1], channels[2], channels[3]);
+		return true;
+	}
+
+	// Block that crosses the clip rectangle : every pixel is checked on its own.
+	template <typename DepthType>
+	void RasterizeBlockScalar(const TriangleSetup& InSetup, const INT64* InEdges, int InBlockX, int InBlockY,
+		Color32* InColorBuffer, typename DepthType::StorageType* InDepthBuffer, int InPitch, int InClipMinX, int InClipMinY, int InClipMaxX, int InClipMaxY,
+		HierarchicalDepth* InHierarchicalDepth)
+	{
+		for (int y = 0; y < TriangleRasterizer::BlockSize; ++y)
+		{
+			int pixelY = InBlockY + y;
+			if (pixelY < InClipMinY || pixelY >= InClipMaxY)
+			{
+				continue;
+			}
+
+			for (int x = 0; x < TriangleRasterizer::BlockSize; ++x)
+			{
+				int pixelX = InBlockX + x;
+				if (pixelX < InClipMinX || pixelX >= InClipMaxX)
+				{
+					continue;
+				}
+
+				bool covered = true;
+				for (int i = 0; i < 3; ++i)
+				{
+					covered &= InEdges[i] + (INT64)InSetup.EdgeStepX[i] * x + (INT64)InSetup.EdgeStepY[i] * y >= 0;
+				}
+
+				if (covered)
+				{
+					size_t index = (size_t)pixelY * InPitch + pixelX;
+					float depthKey = 0.f;
+					if (ShadePixel<DepthType>(InSetup, pixelX - InSetup.MinX, pixelY - InSetup.MinY, InColorBuffer + index, InDepthBuffer + index, depthKey) && InHierarchicalDepth != nullptr)
+					{
+						InHierarchicalDepth->OnPixelWritten(pixelX, pixelY, depthKey);
+					}
+				}
+			}
+		}
+	}
+
+#if defined(PLATFORM_SIMD_SSE2)
+	FORCEINLINE __m128i PackColor4(__m128 InR, __m128 InG, __m128 InB, __m128 InA)
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.f);
+		const __m128 scale = _mm_set1_ps(255.999f);
+		__m128i r = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(InR, zero), one), scale));
+		__m128i g = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(InG, zero), one), scale));
+		__m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(InB, zero), one), scale));
+		__m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(InA, zero), one), scale));
+		return _mm_or_si128(_mm_or_si128(b, _mm_slli_epi32(g, 8)), _mm_or_si128(_mm_slli_epi32(r, 16), _mm_slli_epi32(a, 24)));
+	}
+
+	FORCEINLINE __m128 ToUnormKey4(__m128 InDepth, float InMaxKey)
+	{
+		__m128 clamped = _mm_min_ps(_mm_max_ps(InDepth, _mm_setzero_ps()), _mm_set1_ps(1.f));
+		__m128 scaled = _mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(InMaxKey)), _mm_set1_ps(0.5f));
+		return _mm_cvtepi32_ps(_mm_cvttps_epi32(scaled));
+	}
+
+	// Depth keys of four pixels in a row, in the same units as the scalar depth formats.
+	template <typename DepthType>
+	struct DepthRowSIMD;
+
+	template <>
+	struct DepthRowSIMD<DepthFormatD32F>
+	{
+		FORCEINLINE static __m128 ToKey(__m128 InDepth) { return InDepth; }
+		FORCEINLINE static __m128 Load(const float* InRow) { return _mm_loadu_ps(InRow); }
+		FORCEINLINE static void Store(float* InRow, __m128 InKeys) { _mm_storeu_ps(InRow, InKeys); }
+	};
+
+	template <>
+	struct DepthRowSIMD<DepthFormatD24S8>
+	{
+		FORCEINLINE static __m128 ToKey(__m128 InDepth) { return ToUnormKey4(InDepth, DepthFormatD24S8::MaxKey); }
+
+		FORCEINLINE static __m128 Load(const UINT32* InRow)
+		{
+			__m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InRow));
+			return _mm_cvtepi32_ps(_mm_and_si128(values, _mm_set1_epi32(DepthFormatD24S8::DepthMask)));
+		}
+
+		FORCEINLINE static void Store(UINT32* InRow, __m128 InKeys)
+		{
+			// The stencil byte is read back and kept.
+			const __m128i depthMask = _mm_set1_epi32(DepthFormatD24S8::DepthMask);
+			__m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InRow));
+			values = _mm_or_si128(_mm_andnot_si128(depthMask, values), _mm_cvttps_epi32(InKeys));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(InRow), values);
+		}
+	};
+
+	template <>
+	struct DepthRowSIMD<DepthFormatD16>
+	{
+		FORCEINLINE static __m128 ToKey(__m128 InDepth) { return ToUnormKey4(InDepth, DepthFormatD16::MaxKey); }
+
+		FORCEINLINE static __m128 Load(const UINT16* InRow)
+		{
+			__m128i values = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(InRow));
+			return _mm_cvtepi32_ps(_mm_unpacklo_epi16(values, _mm_setzero_si128()));
+		}
+
+		FORCEINLINE static void Store(UINT16* InRow, __m128 InKeys)
+		{
+			// Sign extending the low halves lets the saturating pack keep them unchanged.
+			__m128i values = _mm_cvttps_epi32(InKeys);
+			values = _mm_srai_epi32(_mm_slli_epi32(values, 16), 16);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(InRow), _mm_packs_epi32(values, values));
+		}
+	};
+
+	// Block fully inside the clip rectangle : one row of four pixels per step.
+	// When the depth bounds show that every pixel is closer, the depth compare is skipped.
+	template <typename DepthType>
+	void RasterizeBlockSIMD(const TriangleSetup& InSetup, const INT64* InEdges, bool InFullyCovered, bool InDepthPasses, int InBlockX, int InBlockY,
+		Color32* InColorBuffer, typename DepthType::StorageType* InDepthBuffer, int InPitch, HierarchicalDepth* InHierarchicalDepth)
+	{
+		const __m128 laneOffset = _mm_set_ps(3.f, 2.f, 1.f, 0.f);
+
+		__m128i edges[3];
+		__m128i edgeStepY[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			// Lane offsets are at most 3 steps, so the clamped value keeps its sign for every lane.
+			int stepX = InSetup.EdgeStepX[i];
+			edges[i] = _mm_add_epi32(_mm_set1_epi32(ClampEdge(InEdges[i])), _mm_set_epi32(stepX * 3, stepX * 2, stepX, 0));
+			edgeStepY[i] = _mm_set1_epi32(InSetup.EdgeStepY[i]);
+		}
+
+		float offsetX = (float)(InBlockX - InSetup.MinX);
+		float offsetY = (float)(InBlockY - InSetup.MinY);
+		__m128 laneX = _mm_add_ps(_mm_set1_ps(offsetX), laneOffset);
+
+		__m128 z = _mm_add_ps(_mm_set1_ps(InSetup.Z + InSetup.ZStepY * offsetY), _mm_mul_ps(_mm_set1_ps(InSetup.ZStepX), laneX));
+		const __m128 zStepY = _mm_set1_ps(InSetup.ZStepY);
+
+		// Only read for interpolated colors, but zeroed so the flat path does not leave them uninitialized.
+		__m128 channels[4] = {};
+		__m128 channelStepY[4] = {};
+		if (!InSetup.IsFlatColor)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				channels[i] = _mm_add_ps(_mm_set1_ps(InSetup.Color[i] + InSetup.ColorStepY[i] * offsetY), _mm_mul_ps(_mm_set1_ps(InSetup.ColorStepX[i]), laneX));
+				channelStepY[i] = _mm_set1_ps(InSetup.ColorStepY[i]);
+			}
+		}
+		const __m128i flatColor = _mm_set1_epi32((int)InSetup.FlatColor.GetColorRef());
+
+		Color32* colorRow = InColorBuffer + (size_t)InBlockY * InPitch + InBlockX;
+		typename DepthType::StorageType* depthRow = InDepthBuffer + (size_t)InBlockY * InPitch + InBlockX;
+		__m128 blockMin = _mm_set1_ps(INFINITY);
+		__m128 blockMax = _mm_set1_ps(-INFINITY);
+		int writtenMask = 0;
+		for (int y = 0; y < TriangleRasterizer::BlockSize; ++y)
+		{
+			__m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			if (!InFullyCovered)
+			{
+				__m128i outside = _mm_or_si128(_mm_or_si128(edges[0], edges[1]), edges[2]);
+				mask = _mm_castsi128_ps(_mm_cmpgt_epi32(outside, _mm_set1_epi32(-1)));
+			}
+
+			__m128 depthKey = DepthRowSIMD<DepthType>::ToKey(z);
+			__m128 depth = DepthRowSIMD<DepthType>::Load(depthRow);
+			if (!InDepthPasses)
+			{
+				mask = _mm_and_ps(mask, _mm_cmplt_ps(depthKey, depth));
+			}
+
+			int rowMask = _mm_movemask_ps(mask);
+			if (rowMask != 0)
+			{
+				depth = _mm_or_ps(_mm_and_ps(mask, depthKey), _mm_andnot_ps(mask, depth));
+				DepthRowSIMD<DepthType>::Store(depthRow, depth);
+
+				__m128i color = flatColor;
+				if (!InSetup.IsFlatColor)
+				{
+					color = PackColor4(channels[0], channels[1], channels[2], channels[3]);
+				}
+
+				__m128i colorMask = _mm_castps_si128(mask);
+				__m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colorRow));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(colorRow), _mm_or_si128(_mm_and_si128(colorMask, color), _mm_andnot_si128(colorMask, dest)));
+			}
+
+			writtenMask |= rowMask;
+			blockMin = _mm_min_ps(blockMin, depth);
+			blockMax = _mm_max_ps(blockMax, depth);
+
+			for (int i = 0; i < 3; ++i)
+			{
+				edges[i] = _mm_add_epi32(edges[i], edgeStepY[i]);
+			}
+			z = _mm_add_ps(z, zStepY);
+			if (!InSetup.IsFlatColor)
+			{
+				for (int i = 0; i < 4; ++i)
+				{
+					channels[i] = _mm_add_ps(channels[i], channelStepY[i]);
+				}
+			}
+
+			colorRow += InPitch;
+			depthRow += InPitch;
+		}
+
+		if (writtenMask != 0 && InHierarchicalDepth != nullptr)
+		{
+			blockMin = _mm_min_ps(blockMin, _mm_shuffle_ps(blockMin, blockMin, _MM_SHUFFLE(1, 0, 3, 2)));
+			blockMin = _mm_min_ps(blockMin, _mm_shuffle_ps(blockMin, blockMin, _MM_SHUFFLE(2, 3, 0, 1)));
+			blockMax = _mm_max_ps(blockMax, _mm_shuffle_ps(blockMax, blockMax, _MM_SHUFFLE(1, 0, 3, 2)));
+			blockMax = _mm_max_ps(blockMax, _mm_shuffle_ps(blockMax, blockMax, _MM_SHUFFLE(2, 3, 0, 1)));
+			InHierarchicalDepth->SetBlockBounds(InBlockX >> HierarchicalDepth::BlockShift, InBlockY >> HierarchicalDepth::BlockShift,
+				_mm_cvtss_f32(blockMin), _mm_cvtss_f32(blockMax));
+		}
+	}
+#endif
+
+	// Block traversal for one depth format. Plane depths are turned into keys of the format before they are
+	// compared with the depth bounds, and since keys keep the order of depths the block tests stay conservative.
+	template <typename DepthType>
+	void RasterizeTriangle(const TriangleSetup& InSetup, Color32* InColorBuffer, typename DepthType::StorageType* InDepthBuffer, int InPitch,
+		int InClipMinX, int InClipMinY, int InClipMaxX, int InClipMaxY, HierarchicalDepth* InHierarchicalDepth)
+	{
+		const int BlockSize = TriangleRasterizer::BlockSize;
+
+		int minX = Math::Max(InSetup.MinX, InClipMinX);
+		int minY = Math::Max(InSetup.MinY, InClipMinY);
+		int maxX = Math::Min(InSetup.MaxX, InClipMaxX);
+		int maxY = Math::Min(InSetup.MaxY, InClipMaxY);
+		if (minX >= maxX || minY >= maxY)
+		{
+			return;
+		}
+
+		// Edge ranges over a block, used for the trivial reject and accept tests.
+		INT64 blockMaxOffset[3];
+		INT64 blockMinOffset[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			INT64 spanX = (INT64)InSetup.EdgeStepX[i] * (BlockSize - 1);
+			INT64 spanY = (INT64)InSetup.EdgeStepY[i] * (BlockSize - 1);
+			blockMaxOffset[i] = Math::Max(spanX, 0ll) + Math::Max(spanY, 0ll);
+			blockMinOffset[i] = Math::Min(spanX, 0ll) + Math::Min(spanY, 0ll);
+		}
+
+		// Depth range of the triangle plane over a block.
+		const float zBlockMinOffset = Math::Min(InSetup.ZStepX * (BlockSize - 1), 0.f) + Math::Min(InSetup.ZStepY * (BlockSize - 1), 0.f);
+		const float zBlockMaxOffset = Math::Max(InSetup.ZStepX * (BlockSize - 1), 0.f) + Math::Max(InSetup.ZStepY * (BlockSize - 1), 0.f);
+		UINT64 culledBlocks = 0;
+		UINT64 rasterizedBlocks = 0;
+
+		int startBlockX = minX & ~(BlockSize - 1);
+		int startBlockY = minY & ~(BlockSize - 1);
+		INT64 rowEdges[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			rowEdges[i] = InSetup.Edge[i] + (INT64)InSetup.EdgeStepX[i] * (startBlockX - InSetup.MinX) + (INT64)InSetup.EdgeStepY[i] * (startBlockY - InSetup.MinY);
+		}
+
+		for (int blockY = startBlockY; blockY < maxY; blockY += BlockSize)
+		{
+			INT64 edges[3] = { rowEdges[0], rowEdges[1], rowEdges[2] };
+	#if defined(PLATFORM_SIMD_SSE2)
+			bool rowInClip = blockY >= InClipMinY && blockY + BlockSize <= InClipMaxY;
+	#endif
+			for (int blockX = startBlockX; blockX < maxX; blockX += BlockSize)
+			{
+				bool outside = false;
+				bool fullyCovered = true;
+				for (int i = 0; i < 3; ++i)
+				{
+					outside |= edges[i] + blockMaxOffset[i] < 0;
+					fullyCovered &= edges[i] + blockMinOffset[i] >= 0;
+				}
+
+				bool depthPasses = false;
+				if (!outside && InHierarchicalDepth != nullptr)
+				{
+					// A block whose nearest plane depth is not closer than its farthest stored depth cannot pass.
+					float zCorner = InSetup.Z + InSetup.ZStepX * (blockX - InSetup.MinX) + InSetup.ZStepY * (blockY - InSetup.MinY);
+					int hierarchicalX = blockX >> HierarchicalDepth::BlockShift;
+					int hierarchicalY = blockY >> HierarchicalDepth::BlockShift;
+					if (!(DepthType::ToKey(zCorner + zBlockMinOffset) < InHierarchicalDepth->GetBlockMax(hierarchicalX, hierarchicalY)))
+					{
+						outside = true;
+						culledBlocks++;
+					}
+					else
+					{
+						depthPasses = DepthType::ToKey(zCorner + zBlockMaxOffset) < InHierarchicalDepth->GetBlockMin(hierarchicalX, hierarchicalY);
+					}
+				}
+
+				if (!outside)
+				{
+					rasterizedBlocks++;
+	#if defined(PLATFORM_SIMD_SSE2)
+					if (rowInClip && blockX >= InClipMinX && blockX + BlockSize <= InClipMaxX)
+					{
+						RasterizeBlockSIMD<DepthType>(InSetup, edges, fullyCovered, depthPasses, blockX, blockY, InColorBuffer, InDepthBuffer, InPitch, InHierarchicalDepth);
+					}
+					else
+	#endif
+					{
+						RasterizeBlockScalar<DepthType>(InSetup, edges, blockX, blockY, InColorBuffer, InDepthBuffer, InPitch,
+							InClipMinX, InClipMinY, InClipMaxX, InClipMaxY, InHierarchicalDepth);
+					}
+				}
+
+				for (int i = 0; i < 3; ++i)
+				{
+					edges[i] += (INT64)InSetup.EdgeStepX[i] * BlockSize;
+				}
+			}
+
+			for (int i = 0; i < 3; ++i)
+			{
+				rowEdges[i] += (INT64)InSetup.EdgeStepY[i] * BlockSize;
+			}
+		}
+
+		if (InHierarchicalDepth != nullptr)
+		{
+			InHierarchicalDepth->AddStatistics(0, culledBlocks, rasterizedBlocks);
+		}
+	}
+}
+
+bool TriangleRasterizer::Setup(const ScreenPoint& InScreenSize, const Vector3* InPositions, const LinearColor* InColors, TriangleSetup& OutSetup)
+{
+	const float halfWidth = InScreenSize.X * 0.5f;
+	const float halfHeight = InScreenSize.Y * 0.5f;
+
+	int order[3] = { 0, 1, 2 };
+	INT64 fixedX[3];
+	INT64 fixedY[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		float screenX = InPositions[i].X + halfWidth;
+		float screenY = -InPositions[i].Y + halfHeight;
+		if (!(Math::Abs(screenX) <= GuardBand && Math::Abs(screenY) <= GuardBand))
+		{
+			return false;
+		}
+
+		fixedX[i] = (INT64)Math::RountToInt(screenX * SubPixelScale);
+		fixedY[i] = (INT64)Math::RountToInt(screenY * SubPixelScale);
+	}
+
+	INT64 area = (fixedX[1] - fixedX[0]) * (fixedY[2] - fixedY[0]) - (fixedY[1] - fixedY[0]) * (fixedX[2] - fixedX[0]);
+	if (area == 0)
+	{
+		return false;
+	}
+
+	// Both windings are drawn : the vertex order is flipped so that the inside of every edge is positive.
+	if (area < 0)
+	{
+		std::swap(order[1], order[2]);
+		std::swap(fixedX[1], fixedX[2]);
+		std::swap(fixedY[1], fixedY[2]);
+		area = -area;
+	}
+
+	// Pixel centers sit at half a pixel, which is SubPixelScale / 2 in fixed point.
+	const INT64 halfPixel = SubPixelScale / 2;
+	INT64 minFixedX = Math::Min(fixedX[0], Math::Min(fixedX[1], fixedX[2]));
+	INT64 minFixedY = Math::Min(fixedY[0], Math::Min(fixedY[1], fixedY[2]));
+	INT64 maxFixedX = Math::Max(fixedX[0], Math::Max(fixedX[1], fixedX[2]));
+	INT64 maxFixedY = Math::Max(fixedY[0], Math::Max(fixedY[1], fixedY[2]));
+	OutSetup.MinX = Math::Max((int)((minFixedX - halfPixel + SubPixelScale - 1) >> SubPixelShift), 0);
+	OutSetup.MinY = Math::Max((int)((minFixedY - halfPixel + SubPixelScale - 1) >> SubPixelShift), 0);
+	OutSetup.MaxX = Math::Min((int)((maxFixedX - halfPixel) >> SubPixelShift) + 1, InScreenSize.X);
+	OutSetup.MaxY = Math::Min((int)((maxFixedY - halfPixel) >> SubPixelShift) + 1, InScreenSize.Y);
+	if (OutSetup.MinX >= OutSetup.MaxX || OutSetup.MinY >= OutSetup.MaxY)
+	{
+		return false;
+	}
+
+	INT64 sampleX = ((INT64)OutSetup.MinX << SubPixelShift) + halfPixel;
+	INT64 sampleY = ((INT64)OutSetup.MinY << SubPixelShift) + halfPixel;
+	for (int i = 0; i < 3; ++i)
+	{
+		// Edge i runs between the two vertices other than i.
+		int from = (i + 1) % 3;
+		int to = (i + 2) % 3;
+		INT64 deltaX = fixedX[to] - fixedX[from];
+		INT64 deltaY = fixedY[to] - fixedY[from];
+
+		// Top-left rule : pixels exactly on a right or bottom edge belong to the neighbouring triangle.
+		bool topLeft = deltaY < 0 || (deltaY == 0 && deltaX > 0);
+		OutSetup.Edge[i] = deltaX * (sampleY - fixedY[from]) - deltaY * (sampleX - fixedX[from]) - (topLeft ? 0 : 1);
+		OutSetup.EdgeStepX[i] = (int)(-deltaY * SubPixelScale);
+		OutSetup.EdgeStepY[i] = (int)(deltaX * SubPixelScale);
+	}
+
+	// Attribute planes use the snapped positions so that they agree with coverage.
+	double x1 = (double)(fixedX[1] - fixedX[0]) / SubPixelScale;
+	double y1 = (double)(fixedY[1] - fixedY[0]) / SubPixelScale;
+	double x2 = (double)(fixedX[2] - fixedX[0]) / SubPixelScale;
+	double y2 = (double)(fixedY[2] - fixedY[0]) / SubPixelScale;
+	double invArea = 1.0 / (x1 * y2 - y1 * x2);
+	double centerX = OutSetup.MinX + 0.5 - (double)fixedX[0] / SubPixelScale;
+	double centerY = OutSetup.MinY + 0.5 - (double)fixedY[0] / SubPixelScale;
+
+	auto setupPlane = [&](double InValue0, double InValue1, double InValue2, float& OutValue, float& OutStepX, float& OutStepY)
+	{
+		double delta1 = InValue1 - InValue0;
+		double delta2 = InValue2 - InValue0;
+		double stepX = (delta1 * y2 - delta2 * y1) * invArea;
+		double stepY = (delta2 * x1 - delta1 * x2) * invArea;
+		OutValue = (float)(InValue0 + stepX * centerX + stepY * centerY);
+		OutStepX = (float)stepX;
+		OutStepY = (float)stepY;
+	};
+
+	const Vector3& p0 = InPositions[order[0]];
+	const Vector3& p1 = InPositions[order[1]];
+	const Vector3& p2 = InPositions[order[2]];
+	setupPlane(p0.Z, p1.Z, p2.Z, OutSetup.Z, OutSetup.ZStepX, OutSetup.ZStepY);
+
+	const LinearColor& c0 = InColors[order[0]];
+	const LinearColor& c1 = InColors[order[1]];
+	const LinearColor& c2 = InColors[order[2]];
+	OutSetup.IsFlatColor = (c0 == c1) && (c0 == c2);
+	OutSetup.FlatColor = c0.ToColor32();
+	if (!OutSetup.IsFlatColor)
+	{
+		setupPlane(c0.R, c1.R, c2.R, OutSetup.Color[0], OutSetup.ColorStepX[0], OutSetup.ColorStepY[0]);
+		setupPlane(c0.G, c1.G, c2.G, OutSetup.Color[1], OutSetup.ColorStepX[1], OutSetup.ColorStepY[1]);
+		setupPlane(c0.B, c1.B, c2.B, OutSetup.Color[2], OutSetup.ColorStepX[2], OutSetup.ColorStepY[2]);
+		setupPlane(c0.A, c1.A, c2.A, OutSetup.Color[3], OutSetup.ColorStepX[3], OutSetup.ColorStepY[3]);
+	}
+
+	return true;
+}
+
+float TriangleRasterizer::GetNearestDepth(const TriangleSetup& InSetup)
+{
+	float width = (float)(InSetup.MaxX - InSetup.MinX - 1);
+	float height = (float)(InSetup.MaxY - InSetup.MinY - 1);
+	return InSetup.Z + Math::Min(InSetup.ZStepX * width, 0.f) + Math::Min(InSetup.ZStepY * height, 0.f);
+}
+
+void TriangleRasterizer::Rasterize(const TriangleSetup& InSetup, Color32* InColorBuffer, void* InDepthBuffer, DepthFormat InDepthFormat, int InPitch,
+	int InClipMinX, int InClipMinY, int InClipMaxX, int InClipMaxY, HierarchicalDepth* InHierarchicalDepth)
+{
+	static_assert(BlockSize == HierarchicalDepth::BlockSize, "Depth bounds are kept per rasterizer block.");
+
+	switch (InDepthFormat)
+	{
+	case DepthFormat::D24S8:
+		RasterizeTriangle<DepthFormatD24S8>(InSetup, InColorBuffer, static_cast<UINT32*>(InDepthBuffer), InPitch,
+			InClipMinX, InClipMinY, InClipMaxX, InClipMaxY, InHierarchicalDepth);
+		break;
+	case DepthFormat::D16:
+		RasterizeTriangle<DepthFormatD16>(InSetup, InColorBuffer, static_cast<UINT16*>(InDepthBuffer), InPitch,
+			InClipMinX, InClipMinY, InClipMaxX, InClipMaxY, InHierarchicalDepth);
+		break;
+	default:
+		RasterizeTriangle<DepthFormatD32F>(InSetup, InColorBuffer, static_cast<float*>(InDepthBuffer), InPitch,
+			InClipMinX, InClipMinY, InClipMaxX, InClipMaxY, InHierarchicalDepth);
+		break;
+	}
+}
@@ -3,70 +3,130 @@
 
 WindowsRSI::~WindowsRSI()
 {
+	ReleaseBuffer();
 }
 
-bool WindowsRSI::Init(const ScreenPoint& InScreenSize)
+bool WindowsRSI::CreateColorBuffers(UINT32 InBufferCount)
 {
-	return InitializeGDI(InScreenSize);
-}
+	_Handle = ::GetActiveWindow();
+	if (_Handle == NULL)
+	{
+		return false;
+	}
 
-void WindowsRSI::Shutdown()
-{
-	ReleaseGDI();
-}
+	_ScreenDC = GetDC(_Handle);
+	if (_ScreenDC == NULL)
+	{
+		return false;
+	}
 
-void WindowsRSI::Clear(const LinearColor & InClearColor)
-{
-	FillBuffer(InClearColor.ToColor32());
-	ClearDepthBuffer();
-}
+	// Color & Bitmap Setting
+	BITMAPINFO bmi;
+	memset(&bmi, 0, sizeof(BITMAPINFO));
+	bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+	bmi.bmiHeader.biWidth = _ScreenSize.X;
+	bmi.bmiHeader.biHeight = -_ScreenSize.Y;
+	bmi.bmiHeader.biPlanes = 1;
+	bmi.bmiHeader.biBitCount = 32;
+	bmi.bmiHeader.biCompression = BI_RGB;
 
-void WindowsRSI::BeginFrame()
-{
-}
+	for (UINT32 i = 0; i < InBufferCount; ++i)
+	{
+		_MemoryDCs[i] = CreateCompatibleDC(_ScreenDC);
+		if (_MemoryDCs[i] == NULL)
+		{
+			return false;
+		}
 
-void WindowsRSI::EndFrame()
-{
-	SwapBuffer();
-}
+		_DIBitmaps[i] = CreateDIBSection(_MemoryDCs[i], &bmi, DIB_RGB_COLORS, (void**)&_ColorBuffers[i], NULL, 0);
+		if (_DIBitmaps[i] == NULL)
+		{
+			return false;
+		}
 
-void WindowsRSI::DrawFullVerticalLine(int InX, const LinearColor & InColor)
-{
-	if (InX < 0 || InX >= _ScreenSize.X)
-	{
-		return;
+		_DefaultBitmaps[i] = (HBITMAP)SelectObject(_MemoryDCs[i], _DIBitmaps[i]);
+		if (_DefaultBitmaps[i] == NULL)
+		{
+			return false;
+		}
 	}
 
-	for (int y = 0; y < _ScreenSize.Y; ++y)
-	{
-		SetPixel(ScreenPoint(InX, y), InColor);
-	}
+	return true;
 }
 
-void WindowsRSI::DrawFullHorizontalLine(int InY, const LinearColor & InColor)
+void WindowsRSI::ReleaseColorBuffers()
 {
-	if (InY < 0 || InY >= _ScreenSize.Y)
+	for (UINT32 i = 0; i < SwapChain::MaxBufferCount; ++i)
 	{
-		return;
+		if (_DefaultBitmaps[i] != NULL)
+		{
+			SelectObject(_MemoryDCs[i], _DefaultBitmaps[i]);
+			_DefaultBitmaps[i] = NULL;
+		}
+
+		if (_DIBitmaps[i] != NULL)
+		{
+			DeleteObject(_DIBitmaps[i]);
+			_DIBitmaps[i] = NULL;
+		}
+
+		if (_MemoryDCs[i] != NULL)
+		{
+			DeleteDC(_MemoryDCs[i]);
+			_MemoryDCs[i] = NULL;
+		}
+
+		_ColorBuffers[i] = nullptr;
 	}
 
-	for (int x = 0; x < _ScreenSize.X; ++x)
+	if (_ScreenDC != NULL)
 	{
-		SetPixel(ScreenPoint(x, InY), InColor);
+		ReleaseDC(_Handle, _ScreenDC);
+		_ScreenDC = NULL;
 	}
 }
 
-void WindowsRSI::DrawPoint(const Vector2& InVectorPos, const LinearColor& InColor)
+void WindowsRSI::FinishFrame(UINT32 InBufferIndex)
 {
-	SetPixel(ScreenPoint::ToScreenCoordinate(_ScreenSize, InVectorPos), InColor);
+	DrawStatisticTexts(_MemoryDCs[InBufferIndex]);
+
+	// GDI batches calls per thread, so the text has to be in the bitmap before another thread copies it.
+	GdiFlush();
 }
 
-void WindowsRSI::PushStatisticText(std::string && InText)
+void WindowsRSI::PresentBuffer(UINT32 InBufferIndex)
 {
-	_StatisticTexts.emplace_back(InText);
+	for (const DirtyTileMask::Rect& rect : _PresentRects[InBufferIndex])
+	{
+		BitBlt(_ScreenDC, rect.MinX, rect.MinY, rect.MaxX - rect.MinX, rect.MaxY - rect.MinY, _MemoryDCs[InBufferIndex], rect.MinX, rect.MinY, SRCCOPY);
+	}
+	GdiFlush();
 }
 
-void WindowsRSI::PushStatisticTexts(std::vector<std::string> && InTexts)
+void WindowsRSI::DrawStatisticTexts(HDC InMemoryDC)
 {
-	std::move(InTexts.begin(), InTexts.end(), std::back_inserter(_StatisticTexts));
+	if (_StatisticTexts.size() == 0)
+	{
+		return;
+	}
+
+	HFONT hFont, hOldFont;
+	hFont = (HFONT)GetStockObject(ANSI_VAR_FONT);
+	if (hOldFont = (HFONT)SelectObject(InMemoryDC, hFont))
+	{
+		static const int leftPosition = 600;
+		static const int topPosition = 10;
+		static const int rowHeight = 20;
+		int currentPosition = topPosition;
+		for (std::vector<std::string>::const_iterator it = _StatisticTexts.begin(); it != _StatisticTexts.end(); ++it)
+		{
+			TextOut(InMemoryDC, leftPosition, currentPosition, (*it).c_str(), (int)((*it).length()));
+			currentPosition += rowHeight;
+		}
+
+		// Text is drawn by GDI outside of the pixel writers.
+		_DirtyTiles.MarkRect(leftPosition, topPosition, _ScreenSize.X, currentPosition);
+
+		SelectObject(InMemoryDC, hOldFont);
+	}
 }
@@ -0,0 +1,107 @@
+#include "Precompiled.h"
+
+WorkerPool::~WorkerPool()
+{
+	Stop();
+}
+
+void WorkerPool::Start(UINT32 InWorkerCount)
+{
+	Stop();
+
+	_Quit = false;
+	for (UINT32 i = 0; i < InWorkerCount; ++i)
+	{
+		_Workers.emplace_back(&WorkerPool::WorkerLoop, this, i);
+	}
+}
+
+void WorkerPool::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(_Mutex);
+		_Quit = true;
+	}
+	_WorkCondition.notify_all();
+
+	for (std::thread& worker : _Workers)
+	{
+		worker.join();
+	}
+	_Workers.clear();
+}
+
+void WorkerPool::Run(UINT32 InTaskCount, const std::function<void(UINT32)>& InTask)
+{
+	if (InTaskCount == 0)
+	{
+		return;
+	}
+
+	if (_Workers.empty() || InTaskCount == 1)
+	{
+		for (UINT32 i = 0; i < InTaskCount; ++i)
+		{
+			InTask(i);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_Mutex);
+		_Task = &InTask;
+		_TaskCount = InTaskCount;
+		_NextTask.store(0, std::memory_order_relaxed);
+		_PendingWorkers = (UINT32)_Workers.size();
+		_Generation++;
+	}
+	_WorkCondition.notify_all();
+
+	ExecuteTasks();
+
+	std::unique_lock<std::mutex> lock(_Mutex);
+	_DoneCondition.wait(lock, [this]() { return _PendingWorkers == 0; });
+	_Task = nullptr;
+}
+
+UINT32 WorkerPool::GetDefaultWorkerCount()
+{
+	UINT32 hardwareCount = std::thread::hardware_concurrency();
+	return hardwareCount > 1 ? hardwareCount - 1 : 0;
+}
+
+void WorkerPool::WorkerLoop(UINT32 InWorkerIndex)
+{
+	Profiler::SetThreadName("Render Worker " + std::to_string(InWorkerIndex));
+	UINT64 seenGeneration = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_Mutex);
+			_WorkCondition.wait(lock, [this, seenGeneration]() { return _Quit || _Generation != seenGeneration; });
+			if (_Quit)
+			{
+				return;
+			}
+
+			seenGeneration = _Generation;
+		}
+
+		ExecuteTasks();
+
+		{
+			std::lock_guard<std::mutex> lock(_Mutex);
+			_PendingWorkers--;
+		}
+		_DoneCondition.notify_one();
+	}
+}
+
+void WorkerPool::ExecuteTasks()
+{
+	UINT32 taskIndex = 0;
+	while ((taskIndex = _NextTask.fetch_add(1, std::memory_order_relaxed)) < _TaskCount)
+	{
+		(*_Task)(taskIndex);
+	}
+}
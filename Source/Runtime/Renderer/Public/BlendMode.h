@@ -0,0 +1,17 @@
+#pragma once
+
+// How a color is combined with the pixel already in the buffer.
+// Src is the color given to the draw call with alpha A, and channels are in [0, 1].
+enum class BlendMode : int
+{
+	// Dst = Src
+	Opaque,
+	// Dst = Src * A + Dst * (1 - A). Opaque colors are plain writes.
+	Alpha,
+	// Dst = Src + Dst * (1 - A), for colors that are already multiplied by their alpha.
+	PremultipliedOver,
+	// Dst = Dst + Src * A, saturated.
+	Additive,
+	// Dst = Dst * (Src * A + 1 - A), a modulate that fades out with alpha.
+	Multiply
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+// Fills color and depth buffers with a constant value.
+// Small buffers use plain stores and stay in cache, large buffers are written with
+// non-temporal stores and split across worker threads once they pass ParallelThreshold.
+class ClearEngine
+{
+public:
+	ClearEngine() = default;
+
+	ClearEngine(const ClearEngine&) = delete;
+	ClearEngine& operator=(const ClearEngine&) = delete;
+
+public:
+	void ClearColor(Color32* InDest, UINT32 InCount, Color32 InColor);
+	// Writes the far depth of the format, with a zero stencil where there is one.
+	void ClearDepth(void* InDest, UINT32 InCount, DepthFormat InFormat);
+
+	static constexpr UINT32 StreamingThreshold = 64 * 1024;
+	static constexpr UINT32 ParallelThreshold = 512 * 1024;
+	static constexpr UINT32 MaxWorkerCount = 7;
+
+private:
+	void Fill(UINT32* InDest, UINT32 InCount, UINT32 InValue);
+	void FillPart(UINT32 InPartIndex, UINT32 InPartCount);
+	void StartWorkers();
+
+	static void FillScalar(UINT32* InDest, UINT32 InCount, UINT32 InValue);
+	static void FillStreaming(UINT32* InDest, UINT32 InCount, UINT32 InValue);
+
+private:
+	WorkerPool _Workers;
+	bool _WorkersStarted = false;
+
+	UINT32* _JobDest = nullptr;
+	UINT32 _JobCount = 0;
+	UINT32 _JobValue = 0;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+// Stored depth is handled as an order preserving key : the float itself for D32F, and the unsigned
+// normalized integer converted to float for the compact formats, which is exact up to 24 bits.
+// Depth tests and depth bounds compare keys, so they agree with a compare of the stored values.
+struct DepthFormatD32F
+{
+	typedef float StorageType;
+
+	FORCEINLINE static float ToKey(float InDepth) { return InDepth; }
+	FORCEINLINE static float FromKey(float InKey) { return InKey; }
+	FORCEINLINE static float Load(StorageType InValue) { return InValue; }
+	FORCEINLINE static void Store(StorageType& OutValue, float InKey) { OutValue = InKey; }
+	FORCEINLINE static float GetClearKey() { return INFINITY; }
+
+	// Bits of positive infinity.
+	static constexpr UINT32 ClearPattern = 0x7F800000;
+};
+
+// Depth in the low 24 bits and stencil in the high byte. Depth writes keep the stencil bits.
+struct DepthFormatD24S8
+{
+	typedef UINT32 StorageType;
+
+	FORCEINLINE static float ToKey(float InDepth) { return (float)(UINT32)(Math::Clamp(InDepth, 0.f, 1.f) * MaxKey + 0.5f); }
+	FORCEINLINE static float FromKey(float InKey) { return InKey / MaxKey; }
+	FORCEINLINE static float Load(StorageType InValue) { return (float)(InValue & DepthMask); }
+	FORCEINLINE static void Store(StorageType& OutValue, float InKey) { OutValue = (OutValue & ~DepthMask) | (UINT32)InKey; }
+	FORCEINLINE static float GetClearKey() { return MaxKey; }
+
+	static constexpr UINT32 DepthMask = 0x00FFFFFF;
+	static constexpr float MaxKey = 16777215.f;
+	// Far depth with a zero stencil.
+	static constexpr UINT32 ClearPattern = DepthMask;
+};
+
+struct DepthFormatD16
+{
+	typedef UINT16 StorageType;
+
+	FORCEINLINE static float ToKey(float InDepth) { return (float)(UINT32)(Math::Clamp(InDepth, 0.f, 1.f) * MaxKey + 0.5f); }
+	FORCEINLINE static float FromKey(float InKey) { return InKey / MaxKey; }
+	FORCEINLINE static float Load(StorageType InValue) { return (float)InValue; }
+	FORCEINLINE static void Store(StorageType& OutValue, float InKey) { OutValue = (UINT16)InKey; }
+	FORCEINLINE static float GetClearKey() { return MaxKey; }
+
+	static constexpr float MaxKey = 65535.f;
+	// Two far depth values.
+	static constexpr UINT32 ClearPattern = 0xFFFFFFFF;
+};
+
+// The same operations for code that only knows the format at run time.
+struct DepthBufferFormat
+{
+	static UINT32 GetPixelSize(DepthFormat InFormat);
+	// Clear value repeated over 32 bits, so that a buffer can be cleared with 32-bit stores.
+	static UINT32 GetClearPattern(DepthFormat InFormat);
+	static float GetClearKey(DepthFormat InFormat);
+
+	static float ToKey(DepthFormat InFormat, float InDepth);
+	static float FromKey(DepthFormat InFormat, float InKey);
+	static float LoadKey(DepthFormat InFormat, const void* InBuffer, size_t InIndex);
+	static void StoreKey(DepthFormat InFormat, void* InBuffer, size_t InIndex, float InKey);
+};
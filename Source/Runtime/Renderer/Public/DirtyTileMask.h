@@ -0,0 +1,67 @@
+#pragma once
+
+// Coarse bitmask of tiles changed since the last present.
+// A tile also remembers whether it still holds nothing but the last clear source,
+// so clearing an untouched tile to the same color or layer does not make it dirty again.
+class DirtyTileMask
+{
+public:
+	struct Rect
+	{
+		int MinX = 0;
+		int MinY = 0;
+		int MaxX = 0;
+		int MaxY = 0;
+	};
+
+public:
+	DirtyTileMask() = default;
+
+public:
+	void Initialize(const ScreenPoint& InScreenSize);
+	void Release();
+
+	FORCEINLINE void Mark(int InX, int InY);
+	void MarkRect(int InMinX, int InMinY, int InMaxX, int InMaxY);
+	void MarkAll();
+
+	// The clear source is either a clear color or the id of a retained layer.
+	void OnClear(UINT64 InClearSource);
+
+	// Appends the dirty region as rectangles in pixel units and resets the mask.
+	void Flush(std::vector<Rect>& OutRects);
+
+	static constexpr int TileShift = 5;
+	static constexpr int TileSize = 1 << TileShift;
+
+private:
+	FORCEINLINE void MarkTile(int InTileIndex);
+	FORCEINLINE bool IsDirtyTile(int InTileIndex) const;
+
+private:
+	ScreenPoint _ScreenSize;
+	int _TileCountX = 0;
+	int _TileCountY = 0;
+
+	std::vector<UINT64> _DirtyBits;
+	std::vector<UINT64> _ClearBits;
+	UINT64 _ClearSource = 0;
+	bool _HasClearSource = false;
+};
+
+FORCEINLINE void DirtyTileMask::MarkTile(int InTileIndex)
+{
+	UINT64 bit = 1ull << (InTileIndex & 63);
+	_DirtyBits[InTileIndex >> 6] |= bit;
+	_ClearBits[InTileIndex >> 6] &= ~bit;
+}
+
+FORCEINLINE bool DirtyTileMask::IsDirtyTile(int InTileIndex) const
+{
+	return (_DirtyBits[InTileIndex >> 6] >> (InTileIndex & 63)) & 1;
+}
+
+FORCEINLINE void DirtyTileMask::Mark(int InX, int InY)
+{
+	MarkTile((InY >> TileShift) * _TileCountX + (InX >> TileShift));
+}
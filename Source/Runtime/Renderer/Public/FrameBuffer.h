@@ -0,0 +1,201 @@
+#pragma once
+
+// Color and depth buffers with everything the backends share : deferred clears, hierarchical depth,
+// the tile rasterizer, dirty tiles, the retained background layer and the swap chain.
+// A backend only creates the color buffers and presents them.
+class FrameBuffer
+{
+public:
+	FrameBuffer() = default;
+	virtual ~FrameBuffer() = default;
+
+	FrameBuffer(const FrameBuffer&) = delete;
+	FrameBuffer& operator=(const FrameBuffer&) = delete;
+
+public:
+	bool InitializeBuffer(const ScreenPoint& InScreenSize, const RenderingSettings& InSettings);
+	void ReleaseBuffer();
+	bool IsBufferInitialized() const { return _BufferInitialized; }
+
+	void FillBuffer(Color32 InColor);
+	void SetFastClearEnabled(bool InEnabled) { _FastClearEnabled = InEnabled; }
+	bool IsFastClearEnabled() const { return _FastClearEnabled; }
+	void SetCurrentBlendMode(BlendMode InMode) { _BlendMode = InMode; }
+	BlendMode GetCurrentBlendMode() const { return _BlendMode; }
+
+	bool BeginLayerCapture(UINT64 InKey);
+	void EndLayerCapture();
+
+	FORCEINLINE LinearColor GetPixel(const ScreenPoint& InPos);
+	FORCEINLINE void SetPixelOpaque(const ScreenPoint& InPos, const LinearColor& InColor);
+	FORCEINLINE void SetPixelAlphaBlending(const ScreenPoint& InPos, const LinearColor& InColor);
+
+	void CreateDepthBuffer();
+	void ClearDepthBuffer();
+	float GetDepthBufferValue(const ScreenPoint& InPos);
+	void SetDepthBufferValue(const ScreenPoint& InPos, float InDepthValue);
+	DepthCullStatistics GetDepthCullStatistics() const { return _HierarchicalDepth.GetStatistics(); }
+	void ResetDepthCullStatistics() { _HierarchicalDepth.ResetStatistics(); }
+
+	Color32* GetScreenBuffer();
+	const RenderingSettings& GetRenderingSettings() const { return _Settings; }
+	UINT64 GetLastPresentedBytes() const { return _LastPresentedBytes; }
+	UINT64 GetTotalPresentedBytes() const { return _TotalPresentedBytes; }
+	UINT64 GetPresentedFrameCount() const { return _PresentedFrameCount; }
+
+	SwapChainStatistics GetSwapChainStatistics() const { return _SwapChain.GetStatistics(); }
+	void WaitForPresents() { _SwapChain.WaitForPresents(); }
+
+	void SwapBuffer();
+
+protected:
+	// Presentation, implemented by every backend. Backends call ReleaseBuffer from their destructor,
+	// since these are no longer theirs once the base destructor runs.
+
+	// Fills _ColorBuffers with InBufferCount buffers of the screen size.
+	virtual bool CreateColorBuffers(UINT32 InBufferCount) = 0;
+	virtual void ReleaseColorBuffers() = 0;
+	// The frame in the buffer is complete and about to be submitted. Pixels written here still count as dirty.
+	virtual void FinishFrame(UINT32 InBufferIndex) = 0;
+	// Runs on the present thread, or inside SwapBuffer with a single buffer.
+	virtual void PresentBuffer(UINT32 InBufferIndex) = 0;
+
+protected:
+	void SetBackBuffer(UINT32 InBufferIndex);
+
+	FORCEINLINE bool IsInScreen(const ScreenPoint& InPos) const;
+	int GetScreenBufferIndex(const ScreenPoint& InPos) const;
+
+	FORCEINLINE void TouchPixel(int InX, int InY);
+	FORCEINLINE void TouchRect(int InMinX, int InMinY, int InMaxX, int InMaxY, bool InFullOverwrite);
+
+	// Interface draws write through these so they can be deferred to the tile rasterizer.
+	// Coordinates must already be clipped to the screen.
+	FORCEINLINE void WritePixel(int InX, int InY, Color32 InColor);
+	void WriteRect(int InMinX, int InMinY, int InMaxX, int InMaxY, Color32 InColor, BlendMode InBlendMode);
+	// Mode for a draw with the given color under the current blend mode.
+	FORCEINLINE BlendMode GetDrawBlendMode(Color32 InColor) const { return SpanBlend::IsOpaque(InColor, _BlendMode) ? BlendMode::Opaque : _BlendMode; }
+	void WriteTriangle(const TriangleSetup& InSetup);
+
+protected:
+	static constexpr size_t BufferAlignment = 64;
+
+	bool _BufferInitialized = false;
+
+	// Back buffer of the swap chain.
+	Color32* _ScreenBuffer = nullptr;
+	Color32* _ColorBuffers[SwapChain::MaxBufferCount] = {};
+	// Rectangles that changed since the previous frame, per buffer, kept until the buffer is presented.
+	std::vector<DirtyTileMask::Rect> _PresentRects[SwapChain::MaxBufferCount];
+	SwapChain _SwapChain;
+	// Pixels of the depth format given in the settings.
+	void* _DepthBuffer = nullptr;
+
+	ScreenPoint _ScreenSize;
+	std::vector<std::string> _StatisticTexts;
+
+	RenderingSettings _Settings;
+	TileRasterizer _TileRasterizer;
+
+	ClearEngine _ClearEngine;
+
+	bool _FastClearEnabled = false;
+	BlendMode _BlendMode = BlendMode::Alpha;
+	TileClearState _ColorClearState;
+	TileClearState _DepthClearState;
+	HierarchicalDepth _HierarchicalDepth;
+
+	DirtyTileMask _DirtyTiles;
+	UINT64 _LastPresentedBytes = 0;
+	UINT64 _TotalPresentedBytes = 0;
+	UINT64 _PresentedFrameCount = 0;
+
+	RetainedLayer _BackgroundLayer;
+	UINT64 _BackgroundLayerKey = 0;
+	bool _CapturingLayer = false;
+	bool _ClearedFromLayer = false;
+	Color32 _LastClearColor;
+};
+
+FORCEINLINE void FrameBuffer::SetPixelOpaque(const ScreenPoint& InPos, const LinearColor& InColor)
+{
+	if (!IsInScreen(InPos))
+	{
+		return;
+	}
+
+	WritePixel(InPos.X, InPos.Y, InColor.ToColor32());
+}
+
+FORCEINLINE void FrameBuffer::SetPixelAlphaBlending(const ScreenPoint & InPos, const LinearColor & InColor)
+{
+	if (!IsInScreen(InPos))
+	{
+		return;
+	}
+
+	WriteRect(InPos.X, InPos.Y, InPos.X + 1, InPos.Y + 1, InColor.ToColor32(), BlendMode::Alpha);
+}
+
+FORCEINLINE bool FrameBuffer::IsInScreen(const ScreenPoint& InPos) const
+{
+	if ((InPos.X < 0 || InPos.X >= _ScreenSize.X) || (InPos.Y < 0 || InPos.Y >= _ScreenSize.Y))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+// Every color write goes through here so deferred clears and dirty tiles stay in sync.
+FORCEINLINE void FrameBuffer::TouchPixel(int InX, int InY)
+{
+	_ColorClearState.Touch(InX, InY);
+	_DirtyTiles.Mark(InX, InY);
+}
+
+FORCEINLINE void FrameBuffer::TouchRect(int InMinX, int InMinY, int InMaxX, int InMaxY, bool InFullOverwrite)
+{
+	_ColorClearState.TouchRect(InMinX, InMinY, InMaxX, InMaxY, InFullOverwrite);
+	_DirtyTiles.MarkRect(InMinX, InMinY, InMaxX, InMaxY);
+}
+
+FORCEINLINE void FrameBuffer::WritePixel(int InX, int InY, Color32 InColor)
+{
+	TouchPixel(InX, InY);
+	if (_TileRasterizer.IsEnabled())
+	{
+		_TileRasterizer.AddRect(InX, InY, InX + 1, InY + 1, InColor, BlendMode::Opaque);
+		return;
+	}
+
+	_ScreenBuffer[InY * _ScreenSize.X + InX] = InColor;
+}
+
+FORCEINLINE int FrameBuffer::GetScreenBufferIndex(const ScreenPoint& InPos) const
+{
+	return InPos.Y * _ScreenSize.X + InPos.X;
+}
+
+FORCEINLINE LinearColor FrameBuffer::GetPixel(const ScreenPoint& InPos)
+{
+	if (!IsInScreen(InPos))
+	{
+		return LinearColor::Error;
+	}
+
+	// Reads have to see the draws recorded so far.
+	if (_TileRasterizer.HasPendingCommands())
+	{
+		_TileRasterizer.Flush();
+	}
+
+	if (_ColorClearState.IsPending(InPos.X, InPos.Y))
+	{
+		return LinearColor(Color32(_ColorClearState.GetClearValue()));
+	}
+
+	Color32* dest = _ScreenBuffer;
+	Color32 bufferColor = *(dest + GetScreenBufferIndex(InPos));
+	return LinearColor(bufferColor);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+// Rendering interface drawn into the shared frame buffer. Backends only add the presentation.
+class FrameBufferRSI : public FrameBuffer, public RenderingSoftwareInterface
+{
+public:
+	FrameBufferRSI() = default;
+
+public:
+	virtual bool Init(const ScreenPoint& InScreenSize, const RenderingSettings& InSettings) override;
+	virtual void Shutdown() override;
+	virtual bool IsInitialized() const { return _BufferInitialized; }
+
+	virtual void Clear(const LinearColor& InClearColor) override;
+	virtual void SetFastClear(bool InEnabled) override { SetFastClearEnabled(InEnabled); }
+	virtual void SetBlendMode(BlendMode InMode) override { SetCurrentBlendMode(InMode); }
+	virtual void BeginFrame() override;
+	virtual void EndFrame() override;
+
+	virtual bool BeginBackgroundLayer(UINT64 InKey) override { return BeginLayerCapture(InKey); }
+	virtual void EndBackgroundLayer() override { EndLayerCapture(); }
+
+	virtual void DrawPoint(const Vector2& InVectorPos, const LinearColor& InColor) override;
+	virtual void DrawPoints(const Vector2* InVectorPositions, const LinearColor* InColors, int InCount) override;
+	virtual void DrawPoints(const Vector2* InVectorPositions, int InCount, const LinearColor& InColor) override;
+	virtual void DrawSpans(const ScreenPoint* InStartPositions, const int* InLengths, const LinearColor* InColors, int InCount) override;
+
+	virtual void DrawFullVerticalLine(int InX, const LinearColor& InColor) override;
+	virtual void DrawFullHorizontalLine(int InY, const LinearColor& InColor) override;
+	virtual void DrawFilledRect(const ScreenPoint& InStartPosition, const ScreenPoint& InSize, const LinearColor& InColor) override;
+
+	virtual void DrawTriangle(const Vector3& InPosition0, const Vector3& InPosition1, const Vector3& InPosition2, const LinearColor& InColor) override;
+	virtual void DrawTriangles(const Vector3* InPositions, const LinearColor* InColors, int InTriangleCount) override;
+
+	virtual void PushStatisticText(std::string && InText) override;
+	virtual void PushStatisticTexts(std::vector<std::string> && InTexts) override;
+
+private:
+	FORCEINLINE void SetPixel(const ScreenPoint& InPos, const LinearColor& InColor);
+};
+
+FORCEINLINE void FrameBufferRSI::SetPixel(const ScreenPoint& InPos, const LinearColor& InColor)
+{
+	SetPixelOpaque(InPos, InColor);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+// Window-less renderer that keeps color and depth in plain aligned memory.
+// Frames are presented to a callback and can be dumped to PPM files.
+class HeadlessRSI : public FrameBufferRSI
+{
+public:
+	// Runs on the present thread for every frame, for example to copy it out or encode it.
+	typedef std::function<void(const Color32* InPixels, const ScreenPoint& InScreenSize)> PresentCallback;
+
+public:
+	HeadlessRSI() = default;
+	~HeadlessRSI();
+
+public:
+	// Has to be set before the buffer is initialized.
+	void SetPresentCallback(const PresentCallback& InCallback) { _PresentCallback = InCallback; }
+
+	// The frame is written to the given path on the next SwapBuffer call.
+	void RequestFrameDump(const std::string& InPath);
+	bool WriteFrameToPPM(const std::string& InPath) const;
+
+protected:
+	virtual bool CreateColorBuffers(UINT32 InBufferCount) override;
+	virtual void ReleaseColorBuffers() override;
+	virtual void FinishFrame(UINT32 InBufferIndex) override;
+	virtual void PresentBuffer(UINT32 InBufferIndex) override;
+
+private:
+	bool WriteBufferToPPM(const std::string& InPath, const Color32* InPixels, const std::vector<std::string>& InStatisticTexts) const;
+
+private:
+	// What the present of a submitted frame needs besides its pixels.
+	struct PresentFrame
+	{
+		std::vector<std::string> StatisticTexts;
+		std::string DumpPath;
+	};
+
+	PresentFrame _PresentFrames[SwapChain::MaxBufferCount];
+	PresentCallback _PresentCallback;
+	std::string _FrameDumpPath;
+};
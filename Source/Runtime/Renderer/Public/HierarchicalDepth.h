@@ -0,0 +1,88 @@
+#pragma once
+
+struct DepthCullStatistics
+{
+	UINT64 CulledTriangles = 0;
+	UINT64 CulledBlocks = 0;
+	UINT64 RasterizedBlocks = 0;
+};
+
+// Depth bounds kept next to the full resolution depth buffer.
+// The fine level stores min and max depth per block of the triangle rasterizer, and the coarse level
+// stores the max of a group of blocks so that a whole primitive can be tested with a few reads.
+// Bounds are conservative : a stored max is never closer and a stored min never farther than the real value.
+// Values are depth keys of the buffer format (see DepthBufferFormat.h), so compact formats are bounded exactly.
+class HierarchicalDepth
+{
+public:
+	HierarchicalDepth() = default;
+
+	HierarchicalDepth(const HierarchicalDepth&) = delete;
+	HierarchicalDepth& operator=(const HierarchicalDepth&) = delete;
+
+public:
+	void Initialize(const ScreenPoint& InScreenSize);
+	void Release();
+	FORCEINLINE bool IsInitialized() const { return !_BlockMax.empty(); }
+
+	void Clear(float InDepth);
+
+	// A single pixel was set to an arbitrary value.
+	FORCEINLINE void OnPixelWritten(int InX, int InY, float InDepth);
+	// Exact bounds of a block that was just rasterized.
+	FORCEINLINE void SetBlockBounds(int InBlockX, int InBlockY, float InMin, float InMax);
+
+	FORCEINLINE float GetBlockMin(int InBlockX, int InBlockY) const { return _BlockMin[InBlockY * _BlockCountX + InBlockX]; }
+	FORCEINLINE float GetBlockMax(int InBlockX, int InBlockY) const { return _BlockMax[InBlockY * _BlockCountX + InBlockX]; }
+
+	// True when no pixel of the rectangle can pass a depth test against the nearest depth given.
+	bool IsOccluded(int InMinX, int InMinY, int InMaxX, int InMaxY, float InNearestDepth);
+
+	void AddStatistics(UINT64 InCulledTriangles, UINT64 InCulledBlocks, UINT64 InRasterizedBlocks);
+	DepthCullStatistics GetStatistics() const;
+	void ResetStatistics();
+
+	static constexpr int BlockShift = 2;
+	static constexpr int BlockSize = 1 << BlockShift;
+	static constexpr int CoarseShift = 5;
+	static constexpr int CoarseSize = 1 << CoarseShift;
+
+private:
+	float RefreshCoarseMax(int InCoarseIndex);
+
+private:
+	int _BlockCountX = 0;
+	int _BlockCountY = 0;
+	int _CoarseCountX = 0;
+	int _CoarseCountY = 0;
+
+	std::vector<float> _BlockMin;
+	std::vector<float> _BlockMax;
+	std::vector<float> _CoarseMax;
+	std::vector<BYTE> _CoarseDirty;
+
+	std::atomic<UINT64> _CulledTriangles{ 0 };
+	std::atomic<UINT64> _CulledBlocks{ 0 };
+	std::atomic<UINT64> _RasterizedBlocks{ 0 };
+};
+
+FORCEINLINE void HierarchicalDepth::OnPixelWritten(int InX, int InY, float InDepth)
+{
+	// The new value may be farther than the old one, so bounds only widen here.
+	int blockIndex = (InY >> BlockShift) * _BlockCountX + (InX >> BlockShift);
+	_BlockMin[blockIndex] = Math::Min(_BlockMin[blockIndex], InDepth);
+	_BlockMax[blockIndex] = Math::Max(_BlockMax[blockIndex], InDepth);
+
+	int coarseIndex = (InY >> CoarseShift) * _CoarseCountX + (InX >> CoarseShift);
+	_CoarseMax[coarseIndex] = Math::Max(_CoarseMax[coarseIndex], InDepth);
+}
+
+FORCEINLINE void HierarchicalDepth::SetBlockBounds(int InBlockX, int InBlockY, float InMin, float InMax)
+{
+	int blockIndex = InBlockY * _BlockCountX + InBlockX;
+	_BlockMin[blockIndex] = InMin;
+	_BlockMax[blockIndex] = InMax;
+
+	// The coarse max can only get closer here, it is recomputed the next time it is read.
+	_CoarseDirty[(InBlockY >> (CoarseShift - BlockShift)) * _CoarseCountX + (InBlockX >> (CoarseShift - BlockShift))] = 1;
+}
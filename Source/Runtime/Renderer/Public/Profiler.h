@@ -0,0 +1,126 @@
+#pragma once
+
+// One finished zone. Names are string literals and are kept by pointer.
+struct ProfileEvent
+{
+	const char* Name = nullptr;
+	UINT64 StartNanoSeconds = 0;
+	UINT64 EndNanoSeconds = 0;
+	UINT32 Depth = 0;
+	UINT32 ThreadIndex = 0;
+};
+
+struct ProfileZoneStatistics
+{
+	std::string Name;
+	UINT32 Count = 0;
+	double MinMilliSeconds = 0.0;
+	double AverageMilliSeconds = 0.0;
+	double P95MilliSeconds = 0.0;
+	double P99MilliSeconds = 0.0;
+	double MaxMilliSeconds = 0.0;
+	double TotalMilliSeconds = 0.0;
+};
+
+// Events gathered from every thread by Profiler::Capture.
+struct ProfileCapture
+{
+	// Per zone name, sorted by total time.
+	void Summarize(std::vector<ProfileZoneStatistics>& OutStatistics) const;
+	std::vector<std::string> GetSummaryTexts() const;
+
+	// Chrome trace event format, for chrome://tracing or Perfetto.
+	bool WriteChromeTrace(const std::string& InPath) const;
+
+	std::vector<ProfileEvent> Events;
+	std::vector<std::string> ThreadNames;
+};
+
+// Records scoped zones into a ring buffer per thread. Only the owning thread writes its buffer and
+// publishes events with one atomic store, so recording takes no lock. The oldest events are overwritten
+// once a buffer is full. Disabled by default, when a zone costs a single relaxed load.
+class Profiler
+{
+public:
+	static constexpr UINT32 EventCapacity = 1 << 16;
+
+public:
+	static void SetEnabled(bool InEnabled) { _Enabled.store(InEnabled, std::memory_order_relaxed); }
+	static bool IsEnabled() { return _Enabled.load(std::memory_order_relaxed); }
+
+	// Name of the calling thread in captures.
+	static void SetThreadName(const std::string& InName);
+
+	// Copies the events recorded since the last Reset. Can run while other threads keep recording.
+	static ProfileCapture Capture();
+	// Later captures start from here.
+	static void Reset();
+
+	static UINT64 GetTimeStamp()
+	{
+		return (UINT64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+private:
+	friend class ProfileScope;
+
+	struct ThreadBuffer
+	{
+		std::unique_ptr<ProfileEvent[]> Events;
+		std::atomic<UINT64> WriteIndex{ 0 };
+		// Owned by the capturing side.
+		UINT64 ReadIndex = 0;
+		// Owned by the recording thread.
+		UINT32 Depth = 0;
+		UINT32 ThreadIndex = 0;
+		std::string Name;
+	};
+
+	static ThreadBuffer& GetThreadBuffer() { return (_ThreadBuffer != nullptr) ? *_ThreadBuffer : RegisterThread(); }
+	static ThreadBuffer& RegisterThread();
+	static void Record(ThreadBuffer& InBuffer, const char* InName, UINT64 InStart, UINT32 InDepth);
+
+private:
+	static std::atomic<bool> _Enabled;
+	static std::mutex _Mutex;
+	static std::vector<std::unique_ptr<ThreadBuffer>> _Buffers;
+	static thread_local ThreadBuffer* _ThreadBuffer;
+};
+
+// Zone from construction to the end of the enclosing scope.
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* InName)
+	{
+		if (Profiler::IsEnabled())
+		{
+			_Buffer = &Profiler::GetThreadBuffer();
+			_Name = InName;
+			_Depth = _Buffer->Depth++;
+			_Start = Profiler::GetTimeStamp();
+		}
+	}
+
+	~ProfileScope()
+	{
+		if (_Buffer != nullptr)
+		{
+			_Buffer->Depth--;
+			Profiler::Record(*_Buffer, _Name, _Start, _Depth);
+		}
+	}
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	Profiler::ThreadBuffer* _Buffer = nullptr;
+	const char* _Name = nullptr;
+	UINT64 _Start = 0;
+	UINT32 _Depth = 0;
+};
+
+#define PROFILE_SCOPE_JOIN_INNER(A, B) A##B
+#define PROFILE_SCOPE_JOIN(A, B) PROFILE_SCOPE_JOIN_INNER(A, B)
+#define PROFILE_SCOPE(InName) ProfileScope PROFILE_SCOPE_JOIN(profileScope, __LINE__)(InName)
@@ -1,10 +1,35 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Profiler.h"
 #include "RenderingSoftwareInterface.h"
+#include "RenderingSettings.h"
+#include "DepthBufferFormat.h"
+#include "WorkerPool.h"
+#include "SpanFill.h"
+#include "SpanBlend.h"
+#include "ClearEngine.h"
+#include "TileClearState.h"
+#include "DirtyTileMask.h"
+#include "RetainedLayer.h"
+#include "HierarchicalDepth.h"
+#include "TriangleRasterizer.h"
+#include "TileRasterizer.h"
+#include "SwapChain.h"
+
+#include "FrameBuffer.h"
+#include "FrameBufferRSI.h"
+#include "Headless/HeadlessRSI.h"
 
 #if defined(PLATFORM_WINDOWS)
 #include <windows.h>
-#include "Windows/WindowsGDI.h"
 #include "Windows/WindowsRSI.h"
 #endif
 
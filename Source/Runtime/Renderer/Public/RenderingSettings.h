@@ -0,0 +1,34 @@
+#pragma once
+
+enum class RasterizerMode : int
+{
+	// Draw calls write the frame buffer as they are issued.
+	Immediate,
+	// Draw calls are recorded, binned into screen tiles and rasterized by a pool of workers at the end of the frame.
+	TileBinned
+};
+
+enum class DepthFormat : int
+{
+	// 32-bit float, cleared to infinity.
+	D32F,
+	// 24-bit unsigned normalized depth packed with an 8-bit stencil. Depth is clamped to [0, 1] and cleared to 1.
+	D24S8,
+	// 16-bit unsigned normalized depth, clamped to [0, 1] and cleared to 1.
+	D16
+};
+
+// Options that are fixed when the renderer is initialized.
+struct RenderingSettings
+{
+	RasterizerMode Rasterizer = RasterizerMode::Immediate;
+
+	// Worker threads for the tile-binned rasterizer. Zero uses one per remaining hardware thread.
+	UINT32 WorkerCount = 0;
+
+	DepthFormat Depth = DepthFormat::D32F;
+
+	// Color buffers in the swap chain. With two or more, finished frames are presented on their own thread
+	// while the next one is drawn.
+	UINT32 BufferCount = 1;
+};
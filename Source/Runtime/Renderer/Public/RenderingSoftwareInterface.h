@@ -3,22 +3,46 @@
 
 #include "ScreenPoint.h"
 #include "LinearColor.h"
+#include "RenderingSettings.h"
+#include "BlendMode.h"
 
 class RenderingSoftwareInterface
 {
 public:
-	virtual bool Init(const ScreenPoint& InSize) = 0;
+	virtual ~RenderingSoftwareInterface() = default;
+
+	virtual bool Init(const ScreenPoint& InSize, const RenderingSettings& InSettings) = 0;
 	virtual void Shutdown() = 0;
 	virtual bool IsInitialized() const = 0;
 
 	virtual void Clear(const LinearColor& InClearColor) = 0;
+	virtual void SetFastClear(bool InEnabled) = 0;
+	// Lines and filled rectangles are combined with the buffer using this mode, Alpha by default.
+	// Points, spans and triangles are always written opaque.
+	virtual void SetBlendMode(BlendMode InMode) = 0;
 	virtual void BeginFrame() = 0;
 	virtual void EndFrame() = 0;
 
+	// Static content drawn between these calls right after Clear is cached and becomes the clear source.
+	// Begin returns false while the cached layer for the key is still valid, and the draws can be skipped.
+	virtual bool BeginBackgroundLayer(UINT64 InKey) = 0;
+	virtual void EndBackgroundLayer() = 0;
+
 	virtual void DrawPoint(const Vector2& InVectorPos, const LinearColor& InColor) = 0;
 
+	// Batched submission : screen mapping and clipping are set up once per call.
+	virtual void DrawPoints(const Vector2* InVectorPositions, const LinearColor* InColors, int InCount) = 0;
+	virtual void DrawPoints(const Vector2* InVectorPositions, int InCount, const LinearColor& InColor) = 0;
+	virtual void DrawSpans(const ScreenPoint* InStartPositions, const int* InLengths, const LinearColor* InColors, int InCount) = 0;
+
 	virtual void DrawFullVerticalLine(int InX, const LinearColor& InColor) = 0;
 	virtual void DrawFullHorizontalLine(int InY, const LinearColor& InColor) = 0;
+	virtual void DrawFilledRect(const ScreenPoint& InStartPosition, const ScreenPoint& InSize, const LinearColor& InColor) = 0;
+
+	// Depth tested triangles. Positions use the same coordinates as points with depth in Z, smaller is closer.
+	// The batched version takes three positions and colors per triangle and interpolates the colors.
+	virtual void DrawTriangle(const Vector3& InPosition0, const Vector3& InPosition1, const Vector3& InPosition2, const LinearColor& InColor) = 0;
+	virtual void DrawTriangles(const Vector3* InPositions, const LinearColor* InColors, int InTriangleCount) = 0;
 
 	virtual void PushStatisticText(std::string && InText) = 0;
 	virtual void PushStatisticTexts(std::vector<std::string> && InTexts) = 0;
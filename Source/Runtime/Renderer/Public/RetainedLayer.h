@@ -0,0 +1,37 @@
+#pragma once
+
+// Cached copy of the frame buffer taken right after static content was drawn.
+// The layer stays valid while the key built from its inputs and the clear color underneath it do not change.
+class RetainedLayer
+{
+public:
+	RetainedLayer() = default;
+	~RetainedLayer();
+
+	RetainedLayer(const RetainedLayer&) = delete;
+	RetainedLayer& operator=(const RetainedLayer&) = delete;
+
+public:
+	bool Allocate(const ScreenPoint& InScreenSize);
+	void Release();
+	void Invalidate() { _Valid = false; }
+
+	FORCEINLINE bool IsAllocated() const { return _Pixels != nullptr; }
+	FORCEINLINE bool IsValid() const { return _Valid; }
+	FORCEINLINE bool IsValidFor(UINT64 InKey) const { return _Valid && _Key == InKey; }
+	FORCEINLINE Color32 GetBaseColor() const { return _BaseColor; }
+
+	// Identifies the current content so that clears to this layer can be told apart from color clears.
+	FORCEINLINE UINT64 GetSourceId() const { return (1ull << 32) | _Serial; }
+
+	void Capture(const Color32* InSource, UINT64 InKey, Color32 InBaseColor);
+	void CopyTo(Color32* InDest) const;
+
+private:
+	Color32* _Pixels = nullptr;
+	UINT32 _PixelCount = 0;
+	UINT64 _Key = 0;
+	UINT32 _Serial = 0;
+	Color32 _BaseColor;
+	bool _Valid = false;
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+// Constant color blending for rows, columns and rectangles of a Color32 buffer in 8-bit fixed point.
+// Every mode works on the premultiplied color and reduces to Dst = (Dst * Scale + Bias) / 255 per
+// channel, or to a saturated add for additive blending, so rows are processed 4 or 8 pixels at a time.
+struct SpanBlend
+{
+	static void BlendRow(Color32* InDest, int InCount, Color32 InColor, BlendMode InMode);
+	static void BlendColumn(Color32* InDest, int InCount, int InPitch, Color32 InColor, BlendMode InMode);
+	static void BlendRect(Color32* InDest, int InPitch, int InWidth, int InHeight, Color32 InColor, BlendMode InMode);
+	static void BlendPixel(Color32& InOutDest, Color32 InColor, BlendMode InMode);
+
+	// True when the color replaces the destination, so the draw is a plain fill.
+	static bool IsOpaque(Color32 InColor, BlendMode InMode);
+	// Color channels multiplied by alpha, rounded to nearest.
+	static Color32 Premultiply(Color32 InColor);
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+// Constant color writers for rows, columns and rectangles of a Color32 buffer.
+// Blending is done by SpanBlend.
+struct SpanFill
+{
+	static void FillRow(Color32* InDest, int InCount, Color32 InColor);
+	static void FillColumn(Color32* InDest, int InCount, int InPitch, Color32 InColor);
+	static void FillRect(Color32* InDest, int InPitch, int InWidth, int InHeight, Color32 InColor);
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+struct SwapChainStatistics
+{
+	UINT64 SubmittedFrameCount = 0;
+	UINT64 PresentedFrameCount = 0;
+
+	// From Submit to the end of the present.
+	double LastLatencyMilliSeconds = 0.0;
+	double AverageLatencyMilliSeconds = 0.0;
+	double MaxLatencyMilliSeconds = 0.0;
+
+	// Frames submitted and not presented yet, counted right after each submit.
+	UINT32 LastQueueDepth = 0;
+	double AverageQueueDepth = 0.0;
+	UINT32 MaxQueueDepth = 0;
+
+	// Time the rendering thread waited for a free back buffer.
+	double StallMilliSeconds = 0.0;
+};
+
+// Ring of color buffers handed from the rendering thread to a present thread. The rendering thread
+// draws the back buffer while the frames submitted before it are presented in order, and the buffer
+// of a frame is reused once that frame is presented. Each side only advances its own counter, so the
+// handoff takes no lock : a side with nothing to do spins briefly and then sleeps until the other one
+// advances. A single buffer presents on the rendering thread inside Submit.
+// The back buffer still holds the frame drawn BufferCount frames ago, so every frame has to clear it.
+class SwapChain
+{
+public:
+	static constexpr UINT32 MaxBufferCount = 4;
+	typedef std::function<void(UINT32 InBufferIndex)> PresentFunction;
+
+public:
+	SwapChain() = default;
+	~SwapChain();
+
+	SwapChain(const SwapChain&) = delete;
+	SwapChain& operator=(const SwapChain&) = delete;
+
+public:
+	// The count is clamped to [1, MaxBufferCount]. The function runs on the present thread.
+	void Initialize(UINT32 InBufferCount, const PresentFunction& InPresent);
+	// Presents the frames still queued and stops the present thread.
+	void Release();
+
+	UINT32 GetBufferCount() const { return _BufferCount; }
+	bool IsThreaded() const { return _PresentThread.joinable(); }
+
+	UINT32 GetBackBufferIndex() const { return (UINT32)(_SubmittedCount.load(std::memory_order_relaxed) % _BufferCount); }
+
+	// Queues the back buffer and returns the index of the next one once it is free.
+	UINT32 Submit();
+	// Returns once every submitted frame is presented.
+	void WaitForPresents();
+
+	// Called from the rendering thread.
+	SwapChainStatistics GetStatistics() const;
+
+private:
+	void PresentLoop();
+	void PresentBuffer(UINT32 InBufferIndex);
+
+	template<typename Predicate>
+	void Wait(Predicate InCondition);
+	void Wake();
+
+private:
+	static constexpr int WaitSpinCount = 64;
+
+	PresentFunction _Present;
+	UINT32 _BufferCount = 1;
+	std::thread _PresentThread;
+
+	// Frames are presented in submission order, so both counters name buffers modulo the count.
+	std::atomic<UINT64> _SubmittedCount{ 0 };
+	std::atomic<UINT64> _PresentedCount{ 0 };
+	std::atomic<bool> _Quit{ false };
+	UINT64 _SubmitTimes[MaxBufferCount] = {};
+
+	std::mutex _SleepMutex;
+	std::condition_variable _SleepCondition;
+	std::atomic<UINT32> _SleeperCount{ 0 };
+
+	// Written by the present thread.
+	std::atomic<UINT64> _LastLatencyNanoSeconds{ 0 };
+	std::atomic<UINT64> _TotalLatencyNanoSeconds{ 0 };
+	std::atomic<UINT64> _MaxLatencyNanoSeconds{ 0 };
+
+	// Written by the rendering thread.
+	UINT32 _LastQueueDepth = 0;
+	UINT32 _MaxQueueDepth = 0;
+	UINT64 _TotalQueueDepth = 0;
+	UINT64 _StallNanoSeconds = 0;
+};
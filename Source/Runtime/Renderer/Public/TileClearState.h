@@ -0,0 +1,64 @@
+#pragma once
+
+// Deferred clear of a 16 or 32-bit buffer at tile granularity.
+// Clear only marks every tile as pending, and a pending tile is filled with the clear
+// value the first time it is touched. Resolve fills whatever is still pending.
+class TileClearState
+{
+public:
+	TileClearState() = default;
+
+public:
+	void Initialize(void* InBuffer, const ScreenPoint& InScreenSize, UINT32 InPixelSize = sizeof(UINT32));
+	void Release();
+	// Points the state at another buffer of the same size. Nothing may be pending.
+	void SetBuffer(void* InBuffer) { assert(_PendingCount == 0); _Buffer = static_cast<BYTE*>(InBuffer); }
+
+	// 16-bit buffers use the low half of the value.
+	void Clear(UINT32 InClearValue);
+	void Resolve();
+	void Discard();
+
+	FORCEINLINE bool HasPendingTiles() const { return _PendingCount > 0; }
+	FORCEINLINE bool IsPending(int InX, int InY) const;
+	FORCEINLINE UINT32 GetClearValue() const { return _ClearValue; }
+	FORCEINLINE void Touch(int InX, int InY);
+	void TouchRect(int InMinX, int InMinY, int InMaxX, int InMaxY, bool InFullOverwrite = false);
+
+	static constexpr int TileShift = 5;
+	static constexpr int TileSize = 1 << TileShift;
+
+private:
+	void Materialize(int InTileX, int InTileY);
+
+private:
+	BYTE* _Buffer = nullptr;
+	UINT32 _PixelSize = sizeof(UINT32);
+	ScreenPoint _ScreenSize;
+	int _TileCountX = 0;
+	int _TileCountY = 0;
+	int _PendingCount = 0;
+	UINT32 _ClearValue = 0;
+	std::vector<BYTE> _PendingTiles;
+};
+
+FORCEINLINE bool TileClearState::IsPending(int InX, int InY) const
+{
+	return _PendingCount > 0 && _PendingTiles[(InY >> TileShift) * _TileCountX + (InX >> TileShift)];
+}
+
+FORCEINLINE void TileClearState::Touch(int InX, int InY)
+{
+	if (_PendingCount == 0)
+	{
+		return;
+	}
+
+	int tileX = InX >> TileShift;
+	int tileY = InY >> TileShift;
+	if (_PendingTiles[tileY * _TileCountX + tileX])
+	{
+		Materialize(tileX, tileY);
+	}
+}
+
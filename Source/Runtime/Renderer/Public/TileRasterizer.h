@@ -0,0 +1,86 @@
+#pragma once
+
+// Sort-middle rasterizer : draw commands are recorded for the frame, binned into screen tiles
+// and the tiles are rasterized independently by a worker pool.
+// Every tile is owned by one thread while it is processed, so pixel writes need no locking,
+// and commands inside a tile keep their submission order.
+class TileRasterizer
+{
+public:
+	TileRasterizer() = default;
+
+	TileRasterizer(const TileRasterizer&) = delete;
+	TileRasterizer& operator=(const TileRasterizer&) = delete;
+
+public:
+	void Initialize(Color32* InBuffer, void* InDepthBuffer, DepthFormat InDepthFormat, HierarchicalDepth* InHierarchicalDepth, const ScreenPoint& InScreenSize, UINT32 InWorkerCount);
+	void Release();
+	FORCEINLINE bool IsEnabled() const { return _Buffer != nullptr; }
+	// Switches to another color buffer of the same size. Recorded commands have to be flushed first.
+	void SetBuffer(Color32* InBuffer) { assert(_Commands.empty()); _Buffer = InBuffer; }
+
+	// The rectangle must already be clipped to the screen.
+	FORCEINLINE void AddRect(int InMinX, int InMinY, int InMaxX, int InMaxY, Color32 InColor, BlendMode InBlendMode);
+	void AddTriangle(const TriangleSetup& InSetup);
+
+	FORCEINLINE bool HasPendingCommands() const { return !_Commands.empty(); }
+	// Recorded triangles also write depth.
+	FORCEINLINE bool HasPendingTriangles() const { return !_Triangles.empty(); }
+
+	// Rasterizes every recorded command into the buffer.
+	void Flush();
+	// Drops recorded commands, used when the whole buffer is about to be overwritten.
+	void Discard();
+
+	UINT32 GetWorkerCount() const { return _Workers.GetWorkerCount(); }
+	UINT64 GetFlushedCommandCount() const { return _FlushedCommandCount; }
+
+	static constexpr int TileShift = 6;
+	static constexpr int TileSize = 1 << TileShift;
+
+private:
+	struct Command
+	{
+		int MinX;
+		int MinY;
+		int MaxX;
+		int MaxY;
+		Color32 Color;
+		BlendMode Blend;
+		// Index into the triangle list, or -1 for a rectangle.
+		int Triangle;
+	};
+
+	void BinCommands();
+	void RasterizeTile(UINT32 InTileIndex);
+
+private:
+	Color32* _Buffer = nullptr;
+	void* _DepthBuffer = nullptr;
+	DepthFormat _DepthFormat = DepthFormat::D32F;
+	HierarchicalDepth* _HierarchicalDepth = nullptr;
+	ScreenPoint _ScreenSize;
+	int _TileCountX = 0;
+	int _TileCountY = 0;
+
+	std::vector<Command> _Commands;
+	std::vector<TriangleSetup> _Triangles;
+	std::vector<std::vector<UINT32>> _Bins;
+	std::vector<UINT32> _ActiveTiles;
+	UINT64 _FlushedCommandCount = 0;
+
+	WorkerPool _Workers;
+};
+
+FORCEINLINE void TileRasterizer::AddRect(int InMinX, int InMinY, int InMaxX, int InMaxY, Color32 InColor, BlendMode InBlendMode)
+{
+	Command command;
+	command.MinX = InMinX;
+	command.MinY = InMinY;
+	command.MaxX = InMaxX;
+	command.MaxY = InMaxY;
+	command.Color = InColor;
+	command.Blend = InBlendMode;
+	command.Triangle = -1;
+	_Commands.push_back(command);
+}
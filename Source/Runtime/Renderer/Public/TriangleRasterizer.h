@@ -0,0 +1,55 @@
+#pragma once
+
+// Triangle prepared for the half-space rasterizer.
+// Edge values and attribute planes are stored for the center of pixel (MinX, MinY)
+// and stepped incrementally from there, so a setup can be rasterized against any clip rectangle.
+struct TriangleSetup
+{
+	// Pixel bounds clipped to the screen, max is exclusive.
+	int MinX = 0;
+	int MinY = 0;
+	int MaxX = 0;
+	int MaxY = 0;
+
+	// Edge functions in 1/16 pixel units with the top-left rule folded in : a pixel is covered when all are >= 0.
+	INT64 Edge[3];
+	int EdgeStepX[3];
+	int EdgeStepY[3];
+
+	float Z = 0.f;
+	float ZStepX = 0.f;
+	float ZStepY = 0.f;
+
+	// R, G, B, A planes. Unused when the color is flat.
+	float Color[4];
+	float ColorStepX[4];
+	float ColorStepY[4];
+
+	bool IsFlatColor = true;
+	Color32 FlatColor;
+};
+
+// Half-space triangle rasterizer with depth test.
+// Traversal walks the bounding box in 4x4 pixel blocks : blocks outside an edge are skipped,
+// blocks inside all edges skip the per-pixel coverage test, and the pixels of a block row
+// are tested, depth compared and shaded four at a time.
+struct TriangleRasterizer
+{
+	// Positions are in the centered coordinates used by DrawPoint, with depth in Z (smaller is closer).
+	// Returns false when nothing on the screen is covered or the triangle leaves the guard band.
+	static bool Setup(const ScreenPoint& InScreenSize, const Vector3* InPositions, const LinearColor* InColors, TriangleSetup& OutSetup);
+
+	// Writes the covered pixels inside the clip rectangle that pass the depth test.
+	// The depth buffer holds values of the given format, and depth bounds are kept as keys of that format.
+	// With depth bounds, occluded blocks are skipped before any per-pixel work and the bounds are kept up to date.
+	static void Rasterize(const TriangleSetup& InSetup, Color32* InColorBuffer, void* InDepthBuffer, DepthFormat InDepthFormat, int InPitch,
+		int InClipMinX, int InClipMinY, int InClipMaxX, int InClipMaxY, HierarchicalDepth* InHierarchicalDepth = nullptr);
+
+	// Nearest depth of the triangle plane over its bounds.
+	static float GetNearestDepth(const TriangleSetup& InSetup);
+
+	static constexpr int SubPixelShift = 4;
+	static constexpr int SubPixelScale = 1 << SubPixelShift;
+	static constexpr float GuardBand = 16384.f;
+	static constexpr int BlockSize = 4;
+};
@@ -1,35 +1,28 @@
-
 #pragma once
 
-class WindowsGDI;
-class WindowsRSI : public WindowsGDI, public RenderingSoftwareInterface
+// Renderer presenting the shared frame buffer to the active window through GDI.
+class WindowsRSI : public FrameBufferRSI
 {
 public:
 	WindowsRSI() = default;
 	~WindowsRSI();
 
-public:
-	virtual bool Init(const ScreenPoint& InScreenSize) override;
-	virtual void Shutdown() override;
-	virtual bool IsInitialized() const { return _GDIInitialized; }
-
-	virtual void Clear(const LinearColor& InClearColor) override;
-	virtual void BeginFrame() override;
-	virtual void EndFrame() override;
-
-	virtual void DrawPoint(const Vector2& InVectorPos, const LinearColor& InColor) override;
+protected:
+	virtual bool CreateColorBuffers(UINT32 InBufferCount) override;
+	virtual void ReleaseColorBuffers() override;
+	virtual void FinishFrame(UINT32 InBufferIndex) override;
+	virtual void PresentBuffer(UINT32 InBufferIndex) override;
 
-	virtual void DrawFullVerticalLine(int InX, const LinearColor& InColor) override;
-	virtual void DrawFullHorizontalLine(int InY, const LinearColor& InColor) override;
-
-	virtual void PushStatisticText(std::string && InText) override;
-	virtual void PushStatisticTexts(std::vector<std::string> && InTexts) override;
+private:
+	void DrawStatisticTexts(HDC InMemoryDC);
 
 private:
-	FORCEINLINE void SetPixel(const ScreenPoint& InPos, const LinearColor& InColor);
+	HWND _Handle = 0;
+	// Only the present thread draws to the screen DC once the swap chain runs.
+	HDC	_ScreenDC = 0;
+
+	// One DIB section per swap chain buffer, whose pixels are the color buffer.
+	HDC _MemoryDCs[SwapChain::MaxBufferCount] = {};
+	HBITMAP _DefaultBitmaps[SwapChain::MaxBufferCount] = {};
+	HBITMAP _DIBitmaps[SwapChain::MaxBufferCount] = {};
 };
-
-FORCEINLINE void WindowsRSI::SetPixel(const ScreenPoint& InPos, const LinearColor& InColor)
-{
-	SetPixelOpaque(InPos, InColor);
-}
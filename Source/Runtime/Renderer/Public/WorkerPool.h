@@ -0,0 +1,44 @@
+#pragma once
+
+// Persistent worker threads that run an indexed task to completion together with the calling thread.
+class WorkerPool
+{
+public:
+	WorkerPool() = default;
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+public:
+	// Upper bound for requested worker counts, so that a bad setting cannot ask for billions of threads.
+	static constexpr UINT32 MaxWorkerCount = 64;
+
+public:
+	void Start(UINT32 InWorkerCount);
+	void Stop();
+	UINT32 GetWorkerCount() const { return (UINT32)_Workers.size(); }
+
+	// Calls InTask for every index in [0, InTaskCount) and returns once all of them are done.
+	void Run(UINT32 InTaskCount, const std::function<void(UINT32)>& InTask);
+
+	// Worker count that leaves the calling thread its own core.
+	static UINT32 GetDefaultWorkerCount();
+
+private:
+	void WorkerLoop(UINT32 InWorkerIndex);
+	void ExecuteTasks();
+
+private:
+	std::vector<std::thread> _Workers;
+	std::mutex _Mutex;
+	std::condition_variable _WorkCondition;
+	std::condition_variable _DoneCondition;
+	UINT64 _Generation = 0;
+	UINT32 _PendingWorkers = 0;
+	bool _Quit = false;
+
+	const std::function<void(UINT32)>* _Task = nullptr;
+	UINT32 _TaskCount = 0;
+	std::atomic<UINT32> _NextTask{ 0 };
+};